@@ -32,15 +32,121 @@
 namespace cv
 {
 	std::vector<float*> geoinfos;
-	std::vector<Mat> maskes;
+	std::vector<MaskSpans> maskSpans;
 	std::vector<vector<float*> > imgInfos;
 
 	const int cells[] = {256, 204, 162, 128, 102, 80, 64};
 	int levels;
 
+	// the position on the spherical image of level 0 of every point of the storage grid
+	// of a level, for the first part; the others are turned by a fifth of the sphere
+	// about its axis, which shifts them by cells[0] on the image
+	std::vector<vector<Point2f> > gridPositions;
+
+	// the hexagonal patch of the intensity centroid, row by row: the coordinates x and y
+	// of the pixels as weights, padded with zeros to 32 pixels so that a row is covered
+	// by two 16-byte loads, and the offsets of the first pixel of the rows for a stride
+	enum { HEX_PATCH_ROWS = 2*SPHORB::SPHORB_EDGE+1, HEX_PATCH_LANES = 32 };
+	short hexPatchWeights[2][HEX_PATCH_ROWS][HEX_PATCH_LANES];
+
+	struct HexPatch
+	{
+		int step;
+		int offsets[HEX_PATCH_ROWS];
+	};
+	std::vector<HexPatch> hexPatches;
+
+	// the sampling pattern rotated to every quantized orientation, 30 bins of 12 degrees,
+	// as offsets from the centre for the row stride of the extended parts of a level;
+	// the pairs are grouped by 16, the first points of a group followed by the second ones;
+	// the points are those of the longest descriptor, the shorter ones using their prefix
+	enum { PATTERN_POINTS = 16*SPHORB::kMaxBytes, PATTERN_BINS = 30, PATTERN_SEXTANT_BINS = PATTERN_BINS/6 };
+
+	// the box descriptor reads the same points from the integral image of the part padded
+	// by BOX_PAD pixels, a tap summing the boxes of tapBoxes around its point
+	enum { BOX_PAD = 2, TAP_BOXES = 3 };
+
+	struct RotatedPattern
+	{
+		int step;
+		vector<int> offsets;
+
+		// the row stride of the padded integral image, the points as offsets in it and
+		// the four corners of every box of a tap, the signs of the corners alternating
+		int integralStep;
+		vector<int> integralOffsets;
+		int boxCorners[TAP_BOXES*4];
+	};
+	std::vector<RotatedPattern> rotatedPatterns;
+
+	static void buildRotatedPattern(int step, RotatedPattern& rotated);
+
+	// the directions of the boundaries between the bins of the upper half plane, at
+	// 6, 18, ..., 174 degrees, which the moment vectors are compared with to find their bin
+	float patternBinBoundaries[PATTERN_BINS/2][2];
+
+	static void buildPatternBinBoundaries()
+	{
+		for (int k=0;k<PATTERN_BINS/2;k++)
+		{
+			double angle = (k + 0.5) * 2*CV_PI/PATTERN_BINS;
+			patternBinBoundaries[k][0] = (float)cos(angle);
+			patternBinBoundaries[k][1] = (float)sin(angle);
+		}
+	}
+
+	// the gaussian smoothing the parts before description, on its hexagonal footprint:
+	// row dy of the kernel has the taps dx = max(-3, -3-dy) .. min(3, 3-dy), with
+	// weights in fixed point, also packed by pairs into the halves of an int
+	enum { HEX_KERNEL_RADIUS = 3, HEX_KERNEL_SIZE = 2*HEX_KERNEL_RADIUS+1, HEX_KERNEL_BITS = 18 };
+
+	struct HexKernel
+	{
+		int xmin[HEX_KERNEL_SIZE];
+		int count[HEX_KERNEL_SIZE];
+		int weights[HEX_KERNEL_SIZE][8];
+		int pairs[HEX_KERNEL_SIZE][4];
+	};
+	HexKernel hexKernel;
+
+	static void buildHexKernel();
+
+	static void buildHexPatchWeights()
+	{
+		const int half_k = SPHORB::SPHORB_EDGE;
+		memset(hexPatchWeights, 0, sizeof(hexPatchWeights));
+		for (int y=-half_k; y<=half_k; y++)
+		{
+			int xmin = y<0 ? -y-half_k : -half_k;
+			int xmax = y<0 ? half_k : half_k-y;
+			for (int x=xmin; x<=xmax; x++)
+			{
+				hexPatchWeights[0][y+half_k][x-xmin] = (short)x;
+				hexPatchWeights[1][y+half_k][x-xmin] = (short)y;
+			}
+		}
+	}
+
+	static void buildHexPatch(int step, HexPatch& patch)
+	{
+		const int half_k = SPHORB::SPHORB_EDGE;
+		patch.step = step;
+		for (int y=-half_k; y<=half_k; y++)
+			patch.offsets[y+half_k] = y*step + (y<0 ? -y-half_k : -half_k);
+	}
+
+	// the number of extractors sharing the tables, the first one loads them and
+	// the last one releases them
+	int sorbUsers = 0;
+	Mutex sorbMutex;
+
 	// load the precomputed information
 	static void initSORB()
 	{
+		AutoLock lock(sorbMutex);
+		if (sorbUsers++ > 0)
+			return;
+
 		levels = sizeof(cells) / sizeof(cells[0]);
 		for (int i=0;i<levels;i++)
 		{
@@ -52,6 +158,17 @@ namespace cv
 			read_pfm(fileName, geoinfo);
 			geoinfos.push_back(geoinfo);
 
+			// the spherical coordinates of the grid points, in pixels of level 0
+			vector<Point2f> positions((cells[i]+1)*(2*cells[i]+1));
+			float c = (float)(CV_PI / (cells[0]*5/2));
+			for (size_t j=0;j<positions.size();j++)
+			{
+				float theta = acos(geoinfo[j*3+2]);
+				float phi = atan2(geoinfo[j*3+1], geoinfo[j*3]) + CV_PI;
+				positions[j] = Point2f(phi / c, theta / c);
+			}
+			gridPositions.push_back(positions);
+
 			// look up table for fast image convertion from spherical image to geodesic grid
 			vector<float*> partInfos;
 			for (int j=0;j<5;j++)
@@ -66,15 +183,33 @@ namespace cv
 			}
 			imgInfos.push_back(partInfos);
 
-			// the mask image
+			// the mask image, kept as the runs of valid pixels on every row
 			sprintf(fileName, "Data/mask%d.bmp", cells[i]);
 			Mat mask = imread(fileName, 0);
-			maskes.push_back(mask);
+			MaskSpans spans;
+			buildMaskSpans(mask, SPHORB::SFAST_EDGE + SPHORB::SPHORB_EDGE, spans);
+			maskSpans.push_back(spans);
+
+			// the patch of the orientation and the rotated patterns of the descriptor
+			// for the row stride of the extended parts
+			int step = 2*cells[i] + 2*(SPHORB::SFAST_EDGE + SPHORB::SPHORB_EDGE);
+			HexPatch patch;
+			buildHexPatch(step, patch);
+			hexPatches.push_back(patch);
+			rotatedPatterns.push_back(RotatedPattern());
+			buildRotatedPattern(step, rotatedPatterns.back());
 		}
+		buildHexPatchWeights();
+		buildHexKernel();
+		buildPatternBinBoundaries();
 	}
 
 	static void uninitSORB()
 	{
+		AutoLock lock(sorbMutex);
+		if (--sorbUsers > 0)
+			return;
+
 		for (size_t i=0;i<geoinfos.size();i++)
 		{
 			if (geoinfos[i]!=NULL)
@@ -97,7 +232,10 @@ namespace cv
 
 		geoinfos.clear();
 		imgInfos.clear();
-		maskes.clear();
+		gridPositions.clear();
+		maskSpans.clear();
+		hexPatches.clear();
+		rotatedPatterns.clear();
 	}
 
 // split spherical image to the storage grid
@@ -249,238 +387,460 @@ static void extendBottomLeft(Mat& newPart1, const Mat& part2, int edge)
 	}
 }
 
-// extend the storage grid
-static void extendEdge(Mat& part0, Mat& part1, Mat& part2, Mat& part3, Mat& part4, int edge)
+// extend the five parts of the storage grid to the extended ones
+static void extendEdge(const Mat* parts, Mat* extended, int edge)
 {
-	int height = part0.rows + edge*2 - 1;
-	int width = part0.cols + edge*2 - 1;
+	int height = parts[0].rows + edge*2 - 1;
+	int width = parts[0].cols + edge*2 - 1;
 
 	// extend the image size
-	Mat _part0 = Mat::zeros(Size(width, height), part0.type());
-	Mat _part1 = Mat::zeros(Size(width, height), part1.type());
-	Mat _part2 = Mat::zeros(Size(width, height), part2.type());
-	Mat _part3 = Mat::zeros(Size(width, height), part3.type());
-	Mat _part4 = Mat::zeros(Size(width, height), part4.type());
-
-	// copy the source data
-	for (int y=edge; y<height-edge+1; y++)
+	for (int i=0;i<5;i++)
 	{
-		for (int x=edge-1; x<width-edge; x++)
-		{
-			_part0.at<uchar>(y,x) = part0.at<uchar>(y-edge, x-edge+1);
-			_part1.at<uchar>(y,x) = part1.at<uchar>(y-edge, x-edge+1);
-			_part2.at<uchar>(y,x) = part2.at<uchar>(y-edge, x-edge+1);
-			_part3.at<uchar>(y,x) = part3.at<uchar>(y-edge, x-edge+1);
-			_part4.at<uchar>(y,x) = part4.at<uchar>(y-edge, x-edge+1);
-
-		}
+		extended[i].create(Size(width, height), parts[i].type());
+		extended[i].setTo(Scalar::all(0));
 	}
 
+	// copy the source data
+	for (int i=0;i<5;i++)
+		for (int y=edge; y<height-edge+1; y++)
+			for (int x=edge-1; x<width-edge; x++)
+				extended[i].at<uchar>(y,x) = parts[i].at<uchar>(y-edge, x-edge+1);
+
 	// extend the edges
-	extendTopRight(_part0, part1, edge);
-	extendTopRight(_part1, part2, edge);
-	extendTopRight(_part2, part3, edge);
-	extendTopRight(_part3, part4, edge);
-	extendTopRight(_part4, part0, edge);
-
-	extendBottomLeft(_part1, part0, edge);
-	extendBottomLeft(_part2, part1, edge);
-	extendBottomLeft(_part3, part2, edge);
-	extendBottomLeft(_part4, part3, edge);
-	extendBottomLeft(_part0, part4, edge);
-
-	// copy the extend image
-	part0 = _part0;
-	part1 = _part1;
-	part2 = _part2;
-	part3 = _part3;
-	part4 = _part4;
-}
-
-// the angle between the x-axis of local coordinate and the south pole
-static float inherentAngle(const float* center, const float* axisx)
-{
-	float t1 = -center[0]*axisx[0]-center[1]*axisx[1]-center[2]*axisx[2]+1.0f;
-	float x1 =  axisx[0] + center[0] * t1;
-	float y1 =  axisx[1] + center[1] * t1;
-	float z1 =  axisx[2] + center[2] * t1;
-
-	float t2 = center[2]+1.0f;
-	float x2 = center[0] * t2;
-	float y2 = center[1] * t2;
-	float z2 = -1 + center[2] * t2;
-
-	x1 -= center[0];
-	y1 -= center[1];
-	z1 -= center[2];
-
-	x2 -= center[0];
-	y2 -= center[1];
-	z2 -= center[2];
-
-	float tmp = (x1*x2+y1*y2+z1*z2) / ( sqrt( (x1*x1+y1*y1+z1*z1) * (x2*x2+y2*y2+z2*z2) ) );
-	if (tmp>1.0f)
-		tmp = 1.0f;
-	if(tmp<-1.0f)
-		tmp = -1.0f;
-	float radian = acos( tmp );
-
-	if (center[0]*axisx[1]-axisx[0]*center[1]<0)
-		return  (float)(-radian*(180.f/CV_PI));
-	else
-		return (float)(radian*(180.f/CV_PI));
+	for (int i=0;i<5;i++)
+		extendTopRight(extended[i], parts[(i+1)%5], edge);
+	for (int i=0;i<5;i++)
+		extendBottomLeft(extended[i], parts[(i+4)%5], edge);
 }
 
-static float IC_Angle(const Mat& img, const int half_k, Point2f pt, const float* geoinfo)
+// resize the spherical image to a level and split it to the five parts of the storage grid,
+// which are then extended
+static void buildStorageGrid(const Mat& sphere, int level, Mat& image, Mat grid[5], Mat subImg[5], int edge)
 {
-	float m_01 = 0, m_10 = 0;
+	// resize the spherical image
+	Size sz(cells[level]*5, cells[level]*5/2);
+	image.create(sz, sphere.type());
+	resize(sphere, image, sz, 0, 0, CV_INTER_AREA);
 
-	int step = (int)img.step1();
-	const uchar* center = &img.at<uchar> (cvRound(pt.y), cvRound(pt.x));
+	// split the spherical image to five parts
+	for(int i=0;i<5;i++)
+	{
+		grid[i].create(Size(2*cells[level]+1, cells[level]+1), image.type());
+		splitSphere2(image, grid[i], i, imgInfos[level][i]);
+	}
+
+	// extend each part for boundary pixels 
+	extendEdge(grid, subImg, edge);
+}
 
-	float tmp = sqrt(3.0f) * 0.5f;
+// the intensity centroid over the hexagonal patch, two dot products per row of the
+// pixels with the hexagonal coordinates x and y, accumulated in integers; the
+// euclidean moments are m_10 = m_x + m_y/2 and m_01 = sqrt(3)/2 * m_y
+static Point2f IC_Moments(const uchar* center, const HexPatch& patch)
+{
+	int m_x, m_y;
 
-	for(int y=-half_k; y<=half_k; y++)
+#if CV_SSE2
+	__m128i z = _mm_setzero_si128(), sx = z, sy = z;
+	for (int r=0;r<HEX_PATCH_ROWS;r++)
 	{
-		int xmax, xmin;
-		if(y<0)
-		{
-			xmin = -y-half_k;
-			xmax = half_k;
-		}
-		else
+		const uchar* ptr = center + patch.offsets[r];
+		const __m128i* wx = (const __m128i*)hexPatchWeights[0][r];
+		const __m128i* wy = (const __m128i*)hexPatchWeights[1][r];
+
+		__m128i v0 = _mm_loadu_si128((const __m128i*)ptr);
+		__m128i v1 = _mm_loadu_si128((const __m128i*)(ptr+16));
+		__m128i p0 = _mm_unpacklo_epi8(v0, z), p1 = _mm_unpackhi_epi8(v0, z);
+		__m128i p2 = _mm_unpacklo_epi8(v1, z), p3 = _mm_unpackhi_epi8(v1, z);
+
+		sx = _mm_add_epi32(sx, _mm_add_epi32(
+			_mm_add_epi32(_mm_madd_epi16(p0, _mm_loadu_si128(wx)), _mm_madd_epi16(p1, _mm_loadu_si128(wx+1))),
+			_mm_add_epi32(_mm_madd_epi16(p2, _mm_loadu_si128(wx+2)), _mm_madd_epi16(p3, _mm_loadu_si128(wx+3)))));
+		sy = _mm_add_epi32(sy, _mm_add_epi32(
+			_mm_add_epi32(_mm_madd_epi16(p0, _mm_loadu_si128(wy)), _mm_madd_epi16(p1, _mm_loadu_si128(wy+1))),
+			_mm_add_epi32(_mm_madd_epi16(p2, _mm_loadu_si128(wy+2)), _mm_madd_epi16(p3, _mm_loadu_si128(wy+3)))));
+	}
+
+	// horizontal sums of the four lanes
+	sx = _mm_add_epi32(sx, _mm_srli_si128(sx, 8));
+	sx = _mm_add_epi32(sx, _mm_srli_si128(sx, 4));
+	sy = _mm_add_epi32(sy, _mm_srli_si128(sy, 8));
+	sy = _mm_add_epi32(sy, _mm_srli_si128(sy, 4));
+	m_x = _mm_cvtsi128_si32(sx);
+	m_y = _mm_cvtsi128_si32(sy);
+#else
+	m_x = m_y = 0;
+	for (int r=0;r<HEX_PATCH_ROWS;r++)
+	{
+		const uchar* ptr = center + patch.offsets[r];
+		const short* wx = hexPatchWeights[0][r];
+		const short* wy = hexPatchWeights[1][r];
+		for (int j=0;j<HEX_PATCH_LANES;j++)
 		{
-			xmin = -half_k;
-			xmax = half_k-y;
+			m_x += wx[j] * ptr[j];
+			m_y += wy[j] * ptr[j];
 		}
+	}
+#endif
 
-		for(int x=xmin; x<=xmax; x++)
-		{
-			float euclidX = x + y * 0.5f;
-			float euclidY = tmp * y;
+	return Point2f(m_x + 0.5f * m_y, sqrt(3.0f) * 0.5f * m_y);
+}
 
-			m_10 += euclidX * center[x+y*step];
-			m_01 += euclidY * center[x+y*step];
+// the moment vector (m_10, m_01) of a keypoint, which points along its orientation
+static Point2f IC_Moments(const Mat& img, const HexPatch& patch, Point2f pt)
+{
+	CV_DbgAssert((int)img.step == patch.step);
 
-		}
+	return IC_Moments(&img.at<uchar> (cvRound(pt.y), cvRound(pt.x)), patch);
+}
 
+// the bin of the orientation of a moment vector, the nearest orientation of the rotated
+// patterns, found without its angle: the lower half plane is turned by 180 degrees onto
+// the upper one, 15 bins further, where the boundaries below the vector are counted by
+// a binary search on the sign of their cross product with it
+static inline int patternBin(Point2f m)
+{
+	int bin = 0;
+	if (m.y < 0 || (m.y == 0 && m.x < 0))
+	{
+		m = Point2f(-m.x, -m.y);
+		bin = PATTERN_BINS/2;
 	}
 
-	return fastAtan2((float)m_01, (float)m_10);
-
-	//int x = pt.x - half_k - 2;
-	//int y = pt.y - half_k - 3;
-	//return fastAtan2((float)m_01, (float)m_10) - inherentAngle(geoinfo+(x+y*513)*3, geoinfo+(x+1+y*513)*3);
+	int lo = 0, hi = PATTERN_BINS/2;
+	while (lo < hi)
+	{
+		int mid = (lo + hi) / 2;
+		if (patternBinBoundaries[mid][0]*m.y - patternBinBoundaries[mid][1]*m.x > 0)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	bin += lo;
+	return bin < PATTERN_BINS ? bin : bin - PATTERN_BINS;
 }
 
-static void computeOrientation(const Mat& image, vector<KeyPoint>& kps, int halfPatchSize, const float* geoinfo)
+#if !CV_SSE2
+// the pattern rotated to the bin of the orientation, read through its offsets,
+// a byte per half group of 16 pairs
+static void computeOrbDescriptor(const uchar* center, const int* offsets, byte* desc, int dsize)
 {
-	for(size_t i=0;i<kps.size();i++)
+	for (int i = 0; i < dsize; ++i)
 	{
-		kps[i].angle = IC_Angle(image, halfPatchSize, kps[i].pt, geoinfo);
+		const int* first = offsets + (i/2)*32 + (i%2)*8;
+		const int* second = first + 16;
+
+		int val = 0;
+		for (int k = 0; k < 8; k++)
+			val |= (center[first[k]] < center[second[k]]) << k;
+
+		desc[i] = (uchar)val;
 	}
 }
+#else
+// the first or second points of the 16 pairs of a group, inserted two by two into
+// the vector rather than stored to memory and loaded back
+static inline __m128i gatherPoints(const uchar* center, const int* offsets)
+{
+	__m128i v = _mm_setzero_si128();
+#define INSERT_POINTS(j) \
+	v = _mm_insert_epi16(v, center[offsets[2*j]] | (center[offsets[2*j+1]] << 8), j)
+	INSERT_POINTS(0); INSERT_POINTS(1); INSERT_POINTS(2); INSERT_POINTS(3);
+	INSERT_POINTS(4); INSERT_POINTS(5); INSERT_POINTS(6); INSERT_POINTS(7);
+#undef INSERT_POINTS
+	return v;
+}
+#endif
 
-static void computeOrbDescriptor(const KeyPoint& kpt, const Mat& img, const Point* pattern, byte* desc, int dsize)
+// the descriptors of the features of a level, written to the rows of descriptors;
+// the 16 pairs of a group are gathered into two vectors and compared at once, the
+// movemask of the comparison giving two bytes of the descriptor
+static void computeOrbDescriptors(const vector<KeyPoint>& kps, const vector<Point2f>& moments, const Mat* parts,
+	const RotatedPattern& rotated, Mat& descriptors, int dsize)
 {
-	float angle = kpt.angle;
-	angle *= (float)(CV_PI/180.f);
-	float a = (float)cos(angle), b = (float)sin(angle);
-	float c = sqrt(3.0f);
-	float d = b*c/3;
-	b = a - d;
-	a = a + d;
-	c = 2 * d;
+#if CV_SSE2
+	const __m128i sign = _mm_set1_epi8((char)0x80);
+#endif
 
-	int step = (int)img.step;
-	const uchar* center = &img.at<uchar>(cvRound(kpt.pt.y), cvRound(kpt.pt.x));
+	for (size_t i=0;i<kps.size();i++)
+	{
+		const Mat& img = parts[kps[i].class_id];
+		CV_DbgAssert((int)img.step == rotated.step);
 
-	// Transform the sampling patterns from rectangle structure to the Euclidean space, 
-	// after rotating the patterns, transform them to the original space.
-#define GET_VALUE(idx) \
-	center[cvRound(pattern[idx].y*a + pattern[idx].x*c)*step + \
-	cvRound(pattern[idx].x*b - pattern[idx].y*c)]
+		byte* desc = descriptors.ptr((int)i);
+		const uchar* center = &img.at<uchar>(cvRound(kps[i].pt.y), cvRound(kps[i].pt.x));
+		const int* offsets = &rotated.offsets[patternBin(moments[i])*PATTERN_POINTS];
 
-	for (int i = 0; i < dsize; ++i, pattern += 16)
-	{
-		int t0, t1, val;
-		t0 = GET_VALUE(0); t1 = GET_VALUE(1);
-		val = t0 < t1;
-		t0 = GET_VALUE(2); t1 = GET_VALUE(3);
-		val |= (t0 < t1) << 1;
-		t0 = GET_VALUE(4); t1 = GET_VALUE(5);
-		val |= (t0 < t1) << 2;
-		t0 = GET_VALUE(6); t1 = GET_VALUE(7);
-		val |= (t0 < t1) << 3;
-		t0 = GET_VALUE(8); t1 = GET_VALUE(9);
-		val |= (t0 < t1) << 4;
-		t0 = GET_VALUE(10); t1 = GET_VALUE(11);
-		val |= (t0 < t1) << 5;
-		t0 = GET_VALUE(12); t1 = GET_VALUE(13);
-		val |= (t0 < t1) << 6;
-		t0 = GET_VALUE(14); t1 = GET_VALUE(15);
-		val |= (t0 < t1) << 7;
+#if CV_SSE2
+		for (int g = 0; g < dsize/2; g++, offsets += 32)
+		{
+			// unsigned comparison of the first and second points through the signed one
+			__m128i first = _mm_xor_si128(gatherPoints(center, offsets), sign);
+			__m128i second = _mm_xor_si128(gatherPoints(center, offsets + 16), sign);
+			int mask = _mm_movemask_epi8(_mm_cmplt_epi8(first, second));
 
-		desc[i] = (uchar)val;
+			desc[2*g] = (uchar)mask;
+			desc[2*g+1] = (uchar)(mask >> 8);
+		}
+#else
+		computeOrbDescriptor(center, offsets, desc, dsize);
+#endif
 	}
-	
-#undef GET_VALUE
 }
 
-static void computeDescriptors(const Mat& image, vector<KeyPoint>& keypoints , Mat& descriptors,
-	const vector<Point>& pattern, int dsize, int WTA_K)
+// the index of a row or column out of a part reflected into it, as BORDER_REFLECT_101
+static inline int reflect101(int i, int n)
+{
+	return i < 0 ? -i : (i >= n ? 2*n-2-i : i);
+}
+
+// the integral image of a part extended by pad reflected pixels on every side, so that
+// the boxes of the taps may reach past the part
+static void boxIntegral(const Mat& src, Mat& sum, int pad)
 {
+	int rows = src.rows + 2*pad, cols = src.cols + 2*pad;
+	sum.create(rows+1, cols+1, CV_32S);
+	memset(sum.ptr<int>(0), 0, (cols+1)*sizeof(int));
 
-	descriptors = Mat::zeros(keypoints.size(), dsize, CV_8UC1);
+	for (int y=0; y<rows; y++)
+	{
+		const uchar* s = src.ptr<uchar>(reflect101(y-pad, src.rows));
+		const int* above = sum.ptr<int>(y);
+		int* row = sum.ptr<int>(y+1);
+		int acc = 0, x = 0;
+
+		row[0] = 0;
+		for (; x<pad; x++)
+		{
+			acc += s[reflect101(x-pad, src.cols)];
+			row[x+1] = above[x+1] + acc;
+		}
+		for (; x<src.cols+pad; x++)
+		{
+			acc += s[x-pad];
+			row[x+1] = above[x+1] + acc;
+		}
+		for (; x<cols; x++)
+		{
+			acc += s[reflect101(x-pad, src.cols)];
+			row[x+1] = above[x+1] + acc;
+		}
+	}
+}
 
+// the weighted sum of a tap, from the corners of its boxes in the integral image
+static inline int tapSum(const int* p, const int* corners)
+{
+	return p[corners[0]] - p[corners[1]] - p[corners[2]] + p[corners[3]]
+		+ p[corners[4]] - p[corners[5]] - p[corners[6]] + p[corners[7]]
+		+ p[corners[8]] - p[corners[9]] - p[corners[10]] + p[corners[11]];
+}
 
-	for (size_t i = 0; i < keypoints.size(); i++)
+// the box descriptors of the features of a level, comparing the sums of the taps of
+// the rotated pattern in the padded integral images of the parts instead of the
+// points of the smoothed parts
+static void computeBoxDescriptors(const vector<KeyPoint>& kps, const vector<Point2f>& moments, const Mat* integrals,
+	const RotatedPattern& rotated, Mat& descriptors, int dsize)
+{
+	for (size_t i=0;i<kps.size();i++)
 	{
-		computeOrbDescriptor(keypoints[i], image, &pattern[0], descriptors.ptr((int)i), dsize);
+		const Mat& sum = integrals[kps[i].class_id];
+		CV_Assert((int)(sum.step/sizeof(int)) == rotated.integralStep);
+
+		const int* center = &sum.at<int>(cvRound(kps[i].pt.y) + BOX_PAD, cvRound(kps[i].pt.x) + BOX_PAD);
+		const int* offsets = &rotated.integralOffsets[patternBin(moments[i])*PATTERN_POINTS];
+		byte* desc = descriptors.ptr((int)i);
+
+		for (int g = 0; g < dsize/2; g++, offsets += 32)
+		{
+			int values[32];
+			for (int k = 0; k < 32; k++)
+				values[k] = tapSum(center + offsets[k], rotated.boxCorners);
+
+#if CV_SSE2
+			// the 16 comparisons of the group narrowed to bytes for a movemask
+			__m128i c0 = _mm_cmplt_epi32(_mm_loadu_si128((const __m128i*)values), _mm_loadu_si128((const __m128i*)(values+16)));
+			__m128i c1 = _mm_cmplt_epi32(_mm_loadu_si128((const __m128i*)(values+4)), _mm_loadu_si128((const __m128i*)(values+20)));
+			__m128i c2 = _mm_cmplt_epi32(_mm_loadu_si128((const __m128i*)(values+8)), _mm_loadu_si128((const __m128i*)(values+24)));
+			__m128i c3 = _mm_cmplt_epi32(_mm_loadu_si128((const __m128i*)(values+12)), _mm_loadu_si128((const __m128i*)(values+28)));
+			int mask = _mm_movemask_epi8(_mm_packs_epi16(_mm_packs_epi32(c0, c1), _mm_packs_epi32(c2, c3)));
+#else
+			int mask = 0;
+			for (int k = 0; k < 16; k++)
+				mask |= (values[k] < values[k+16]) << k;
+#endif
+
+			desc[2*g] = (uchar)mask;
+			desc[2*g+1] = (uchar)(mask >> 8);
+		}
 	}
 }
+
 // map the keypoint of each level of the five part of the storage grid to the original spherical image
-static void mappingKeypoint(const Mat& img, vector<cv::KeyPoint>& kps, int edge, const float* geoinfo, int level)
+// the bearings of the key points, the points of the geodesic grid turned to their part,
+// and their positions on the input image of imageSize are appended when requested
+static void mappingKeypoint(vector<cv::KeyPoint>& kps, int edge, const vector<Point2f>& positions, const float* geoinfo,
+	int level, Size imageSize, vector<Point3f>* bearings, vector<Point2f>* imagePoints)
 {
-
 	float scale = float(cells[0])/float(cells[level]);
 	int pWidth = cells[level]*2+1;
 
+	// the width of the spherical image of level 0, and its share of a part
+	float width = 5.0f*cells[0];
+	float partShift = (float)cells[0];
+
 	float pcos[5] = {cos(0.0), cos(2*CV_PI/5), cos(4*CV_PI/5), cos(6*CV_PI/5), cos(8*CV_PI/5)};
 	float psin[5] = {sin(0.0), sin(2*CV_PI/5), sin(4*CV_PI/5), sin(6*CV_PI/5), sin(8*CV_PI/5)};
-	float c = CV_PI/img.rows;
+	float sx = imageSize.width / width;
+	float sy = imageSize.height / (float)(cells[0]*5/2);
+
 	for (size_t i=0;i<kps.size();i++)
 	{
-		int _x = static_cast<int>(kps[i].pt.x);
-		int _y = static_cast<int>(kps[i].pt.y);
-
 		int x = static_cast<int>(kps[i].pt.x - edge + 1);
 		int y = static_cast<int>(kps[i].pt.y - edge);
+		int part = kps[i].class_id;
 
-		float sX3D = geoinfo[(x+y*pWidth)*3];
-		float sY3D = geoinfo[(x+y*pWidth)*3+1];
-		float sZ3D = geoinfo[(x+y*pWidth)*3+2];
-
-		float dX3D = pcos[kps[i].class_id]*sX3D - psin[kps[i].class_id]*sY3D;
-		float dY3D = pcos[kps[i].class_id]*sY3D + psin[kps[i].class_id]*sX3D;
-		float dZ3D = sZ3D;
+		Point2f p = positions[x+y*pWidth];
+		p.x += part * partShift;
+		if (p.x > width)
+			p.x -= width;
 
-
-		float theta = acos(dZ3D);
-		float phi = atan2(dY3D,dX3D) + CV_PI;
-
-		float panoX = phi / c;
-		float panoY = theta / c;
+		if (bearings)
+		{
+			const float* s = geoinfo + (x+y*pWidth)*3;
+			bearings->push_back(Point3f(pcos[part]*s[0] - psin[part]*s[1], pcos[part]*s[1] + psin[part]*s[0], s[2]));
+		}
+		if (imagePoints)
+			imagePoints->push_back(Point2f(p.x*sx, p.y*sy));
 
 		kps[i].size = 31.0f*scale;
-		kps[i].pt.x = panoX*scale;
-		kps[i].pt.y = panoY*scale;
+		kps[i].pt = p;
 		kps[i].class_id = -1;
 		kps[i].octave = level;
 	}
 }
 
-// the gaussian used to smooth the storage grid
+// the number of key points a cell of the spherical partition holds on average
+static const int featuresPerCell = 4;
+
+// the arrays of retainBestPerCell, which can be reused from call to call
+struct CellBuffer
+{
+	vector<int> area, cellOf, cellStart, fill;
+	vector<KeyPoint> grouped, kept, rest;
+};
+
+// Keep the n strongest key points of a level so that they spread evenly over the sphere.
+// The storage grid of each part is divided into square cells of grid points, which cover
+// nearly equal areas of the sphere since the geodesic grid is nearly regular. Every cell
+// receives a share of n proportional to its valid area and keeps its strongest key points,
+// the budget left by the sparse cells goes to the strongest of the remaining key points.
+static void retainBestPerCell(vector<KeyPoint>& kps, int n, const MaskSpans& mask, int edge, int level, CellBuffer& buffer)
+{
+	if ((int)kps.size() <= n)
+		return;
+
+	int c = cells[level];
+	int ox = edge - 1, oy = edge;
+
+	// the valid area of a part, which is the same on the five parts
+	int totalArea = 0;
+	for (int y=oy; y<=oy+c && y<mask.rows; y++)
+		for (int s=mask.rowStart[y]; s<mask.rowStart[y+1]; s++)
+			totalArea += std::max(0, std::min(mask.spans[s][1], ox+2*c+1) - std::max(mask.spans[s][0], ox));
+	if (totalArea == 0)
+	{
+		retainStrongest(kps, n);
+		return;
+	}
+
+	// the cells are sized so that the valid area of the five parts holds n/featuresPerCell
+	// of them, about half of the storage grid of a part being masked out
+	int cellSize = cvRound(sqrt(5.0 * totalArea * featuresPerCell / n));
+	cellSize = std::max(1, std::min(cellSize, c+1));
+	int cols = (2*c + cellSize) / cellSize;
+	int rows = (c + cellSize) / cellSize;
+	int ncells = cols*rows;
+
+	// the valid area of every cell
+	vector<int>& area = buffer.area;
+	area.assign(ncells, 0);
+	for (int y=oy; y<=oy+c && y<mask.rows; y++)
+	{
+		int* rowArea = &area[((y-oy)/cellSize)*cols];
+		for (int s=mask.rowStart[y]; s<mask.rowStart[y+1]; s++)
+		{
+			int begin = std::max(mask.spans[s][0], ox);
+			int end = std::min(mask.spans[s][1], ox+2*c+1);
+			for (int x=begin; x<end; )
+			{
+				int next = std::min(end, ox + ((x-ox)/cellSize + 1)*cellSize);
+				rowArea[(x-ox)/cellSize] += next - x;
+				x = next;
+			}
+		}
+	}
+
+	// group the key points by cell
+	vector<int>& cellOf = buffer.cellOf;
+	vector<int>& cellStart = buffer.cellStart;
+	cellOf.resize(kps.size());
+	cellStart.assign(5*ncells+1, 0);
+	for (size_t i=0; i<kps.size(); i++)
+	{
+		int bx = std::max(0, std::min(cols-1, (cvRound(kps[i].pt.x) - ox)/cellSize));
+		int by = std::max(0, std::min(rows-1, (cvRound(kps[i].pt.y) - oy)/cellSize));
+		cellOf[i] = kps[i].class_id*ncells + by*cols + bx;
+		cellStart[cellOf[i]+1]++;
+	}
+	for (int i=0; i<5*ncells; i++)
+		cellStart[i+1] += cellStart[i];
+
+	vector<KeyPoint>& grouped = buffer.grouped;
+	vector<int>& fill = buffer.fill;
+	grouped.resize(kps.size());
+	fill.assign(cellStart.begin(), cellStart.end()-1);
+	for (size_t i=0; i<kps.size(); i++)
+		grouped[fill[cellOf[i]]++] = kps[i];
+
+	// every cell keeps at most its quota, its share of n by valid area, picking its
+	// strongest key points by a partial selection and setting the others aside; as the
+	// quotas are rounded, the key points kept are then topped up from the strongest of
+	// those set aside, or cut to the n strongest, so that exactly n are kept
+	vector<KeyPoint>& kept = buffer.kept;
+	vector<KeyPoint>& rest = buffer.rest;
+	kept.clear();
+	rest.clear();
+	double share = n / (5.0 * totalArea);
+	for (int i=0; i<5*ncells; i++)
+	{
+		vector<KeyPoint>::iterator first = grouped.begin() + cellStart[i];
+		vector<KeyPoint>::iterator last = grouped.begin() + cellStart[i+1];
+		int quota = cvRound(share * area[i % ncells]);
+
+		if (last - first > quota)
+		{
+			std::nth_element(first, first + quota, last, ResponseGreater());
+			rest.insert(rest.end(), first + quota, last);
+			last = first + quota;
+		}
+		kept.insert(kept.end(), first, last);
+	}
+
+	if ((int)kept.size() < n)
+	{
+		retainStrongest(rest, n - (int)kept.size());
+		kept.insert(kept.end(), rest.begin(), rest.end());
+	}
+	else if ((int)kept.size() > n)
+		retainStrongest(kept, n);
+
+	// copied rather than swapped, so that both keep their capacity
+	kps.assign(kept.begin(), kept.end());
+}
+
+// the gaussian used to smooth the storage grid, on the 7x7 square of which the 37 taps
+// of the hexagon of radius 3 are non-zero, 4 to 7 per row, and the 12 others are zeros
 static double kernel[] = { 0, 0, 0, 0.007615469730253, 0.012684563109382, 0.012684563109382, 0.007615469730253,
 	0, 0, 0.012684563109382, 0.027267400652990, 0.035191124791545, 0.027267400652990, 0.012684563109382,
 	0, 0.012684563109382, 0.035191124791545, 0.058615431367971, 0.058615431367971, 0.035191124791545, 0.012684563109382,
@@ -489,6 +849,146 @@ static double kernel[] = { 0, 0, 0, 0.007615469730253, 0.012684563109382, 0.0126
 	0.012684563109382, 0.027267400652990, 0.035191124791545, 0.027267400652990, 0.012684563109382, 0, 0,
 	0.007615469730253, 0.012684563109382, 0.012684563109382, 0.007615469730253, 0, 0, 0};
 
+// the fixed point weights of the hexagonal footprint of the kernel, the rounding
+// error goes to the centre so that the weights sum to one exactly
+static void buildHexKernel()
+{
+	const int r = HEX_KERNEL_RADIUS;
+	int sum = 0;
+
+	memset(&hexKernel, 0, sizeof(hexKernel));
+	for (int t=0; t<HEX_KERNEL_SIZE; t++)
+	{
+		int dy = t - r;
+		hexKernel.xmin[t] = std::max(-r, -r-dy);
+		hexKernel.count[t] = std::min(r, r-dy) - hexKernel.xmin[t] + 1;
+		for (int j=0; j<hexKernel.count[t]; j++)
+		{
+			hexKernel.weights[t][j] = cvRound(kernel[t*HEX_KERNEL_SIZE + hexKernel.xmin[t] + j + r] * (1 << HEX_KERNEL_BITS));
+			sum += hexKernel.weights[t][j];
+		}
+	}
+	hexKernel.weights[r][r] += (1 << HEX_KERNEL_BITS) - sum;
+
+	for (int t=0; t<HEX_KERNEL_SIZE; t++)
+		for (int j=0; j<4; j++)
+			hexKernel.pairs[t][j] = (hexKernel.weights[t][2*j+1] << 16) | (hexKernel.weights[t][2*j] & 0xffff);
+}
+
+// a pixel of the smoothed part, the rows and columns out of the part are reflected
+static uchar hexSmoothPixel(const Mat& src, int y, int x)
+{
+	const int r = HEX_KERNEL_RADIUS;
+	int sum = 1 << (HEX_KERNEL_BITS-1);
+
+	for (int t=0; t<HEX_KERNEL_SIZE; t++)
+	{
+		const uchar* row = src.ptr<uchar>(reflect101(y+t-r, src.rows));
+		for (int j=0; j<hexKernel.count[t]; j++)
+			sum += hexKernel.weights[t][j] * row[reflect101(x+hexKernel.xmin[t]+j, src.cols)];
+	}
+
+	return saturate_cast<uchar>(sum >> HEX_KERNEL_BITS);
+}
+
+#if CV_SSE2
+// eight pixels of the smoothed part away from its borders, the taps of a row are taken
+// by pairs, interleaving the pixels under both and multiplying them with madd; the
+// pixel after an odd last tap has a zero weight
+static void hexSmoothPixels8(const Mat& src, int y, int x, uchar* dst)
+{
+	const int r = HEX_KERNEL_RADIUS;
+	__m128i z = _mm_setzero_si128();
+	__m128i acc0 = _mm_set1_epi32(1 << (HEX_KERNEL_BITS-1)), acc1 = acc0;
+
+	for (int t=0; t<HEX_KERNEL_SIZE; t++)
+	{
+		const uchar* s = src.ptr<uchar>(y+t-r) + x + hexKernel.xmin[t];
+		for (int j=0; j<hexKernel.count[t]; j+=2)
+		{
+			__m128i a = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(s+j)), z);
+			__m128i b = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(s+j+1)), z);
+			__m128i w = _mm_set1_epi32(hexKernel.pairs[t][j/2]);
+			acc0 = _mm_add_epi32(acc0, _mm_madd_epi16(_mm_unpacklo_epi16(a, b), w));
+			acc1 = _mm_add_epi32(acc1, _mm_madd_epi16(_mm_unpackhi_epi16(a, b), w));
+		}
+	}
+
+	acc0 = _mm_srai_epi32(acc0, HEX_KERNEL_BITS);
+	acc1 = _mm_srai_epi32(acc1, HEX_KERNEL_BITS);
+	__m128i v = _mm_packs_epi32(acc0, acc1);
+	_mm_storel_epi64((__m128i*)dst, _mm_packus_epi16(v, v));
+}
+#endif
+
+// smooth the pixels [x0, x1) of row y of a part
+static void hexSmoothSpan(const Mat& src, int y, int x0, int x1, uchar* d)
+{
+	int x = x0;
+#if CV_SSE2
+	const int r = HEX_KERNEL_RADIUS;
+	// the loads of eight pixels reach 4 columns past the last one
+	if (y >= r && y < src.rows-r)
+	{
+		for (; x<std::min(r, x1); x++)
+			d[x] = hexSmoothPixel(src, y, x);
+		for (; x+8<=x1 && x+12<=src.cols; x+=8)
+			hexSmoothPixels8(src, y, x, d+x);
+	}
+#endif
+	for (; x<x1; x++)
+		d[x] = hexSmoothPixel(src, y, x);
+}
+
+// smooth a part with the hexagonal gaussian in fixed point, as filter2D with the
+// kernel and reflected borders would
+static void hexGaussianBlur(const Mat& src, Mat& dst)
+{
+	dst.create(src.size(), CV_8UC1);
+	for (int y=0; y<src.rows; y++)
+		hexSmoothSpan(src, y, 0, src.cols, dst.ptr<uchar>(y));
+}
+
+// smooth only the active tiles of a part, by runs of adjacent tiles on every row of
+// tiles; the other pixels of dst are left undefined
+static void hexGaussianBlurTiles(const Mat& src, Mat& dst, const BlockMask& tiles)
+{
+	dst.create(src.size(), CV_8UC1);
+	for (int by=0; by<tiles.rows; by++)
+	{
+		const uchar* active = &tiles.active[by*tiles.cols];
+		int y0 = by*tiles.size, y1 = std::min(y0 + tiles.size, src.rows);
+
+		for (int bx=0; bx<tiles.cols; )
+		{
+			if (!active[bx])
+			{
+				bx++;
+				continue;
+			}
+
+			int bx1 = bx;
+			while (bx1 < tiles.cols && active[bx1])
+				bx1++;
+
+			int x0 = bx*tiles.size, x1 = std::min(bx1*tiles.size, src.cols);
+			for (int y=y0; y<y1; y++)
+				hexSmoothSpan(src, y, x0, x1, dst.ptr<uchar>(y));
+			bx = bx1;
+		}
+	}
+}
+
+// the boxes of a tap of the box descriptor, as {x0, y0, x1, y1} without the last
+// column and row: two skewed squares and a centred one, which together weigh the
+// pixels of the hexagon of radius 2 around the tap by 3, 2 and 1 from its centre
+// out, close to the hexagonal gaussian
+static const int tapBoxes[TAP_BOXES][4] = { {0, -2, 3, 1}, {-2, 0, 1, 3}, {-1, -1, 2, 2} };
+
+// the revision of the sampling pattern, increased whenever bit_pattern is replaced
+// so that the descriptors of different patterns get different versions
+static const int PATTERN_REVISION = 1;
+
 // the sampling pattern
 static int bit_pattern[256*4] =
 {
@@ -750,21 +1250,324 @@ static int bit_pattern[256*4] =
 	-3, -11, -5, -10, /*mean (0.0548529), correlation (0.272518)*/
 };
 
+// the points of the tests of the longest descriptor, those of bit_pattern in the order
+// of the table; a shorter descriptor takes the first tests, whose correlation was
+// measured within the whole table and not as a pattern of their own
+static void buildPattern(vector<Point>& pattern)
+{
+	const Point* pattern0 = (const Point*)bit_pattern;
+	CV_Assert(sizeof(bit_pattern) / sizeof(bit_pattern[0]) / 2 == PATTERN_POINTS);
+
+	pattern.assign(pattern0, pattern0 + PATTERN_POINTS);
+}
+
+// rotate the pattern to the bins of the first sextant as the descriptor does, the
+// other sextants follow exactly on the hexagonal grid, where a rotation by 60 degrees
+// maps (x, y) to (-y, x+y)
+static void buildRotatedPattern(int step, RotatedPattern& rotated)
+{
+	vector<Point> pattern;
+	buildPattern(pattern);
+
+	rotated.step = step;
+	rotated.offsets.resize(PATTERN_BINS*PATTERN_POINTS);
+	rotated.integralStep = step + 2*BOX_PAD + 1;
+	rotated.integralOffsets.resize(PATTERN_BINS*PATTERN_POINTS);
+	for (int k=0;k<PATTERN_SEXTANT_BINS;k++)
+	{
+		float angle = (float)(k*2*CV_PI/PATTERN_BINS);
+		float a = (float)cos(angle), b = (float)sin(angle);
+		float c = sqrt(3.0f);
+		float d = b*c/3;
+		b = a - d;
+		a = a + d;
+		c = 2 * d;
+
+		for (int j=0;j<PATTERN_POINTS;j++)
+		{
+			// the position of the point in its group of 16 pairs
+			int pair = j/2;
+			int pos = (pair/16)*32 + (j%2)*16 + pair%16;
+
+			int x = cvRound(pattern[j].x*b - pattern[j].y*c);
+			int y = cvRound(pattern[j].y*a + pattern[j].x*c);
+			for (int s=0;s<6;s++)
+			{
+				rotated.offsets[(s*PATTERN_SEXTANT_BINS+k)*PATTERN_POINTS+pos] = y*step + x;
+				rotated.integralOffsets[(s*PATTERN_SEXTANT_BINS+k)*PATTERN_POINTS+pos] = y*rotated.integralStep + x;
+				int t = x;
+				x = -y;
+				y = t + y;
+			}
+		}
+	}
+
+	for (int i=0;i<TAP_BOXES;i++)
+	{
+		const int* box = tapBoxes[i];
+		int* corners = rotated.boxCorners + i*4;
+		corners[0] = box[3]*rotated.integralStep + box[2];
+		corners[1] = box[1]*rotated.integralStep + box[2];
+		corners[2] = box[3]*rotated.integralStep + box[0];
+		corners[3] = box[1]*rotated.integralStep + box[0];
+	}
+}
+
+
+// the side of the blocks whose contrast is checked before detection
+static const int contrastBlockSize = 16;
+
+// the coarse to fine detection also explores one block in explorationStride
+// away from the features of the coarser level, a different one every frame
+static const int explorationStride = 7;
+
+// Restrict the blocks of a part to the neighbourhoods of the features of the coarser
+// level and to a sparse set of exploratory blocks. The features are still in the grid
+// coordinates of the coarser level, which scale by the ratio of the cells.
+static void gateBlocks(BlockMask& blocks, const vector<KeyPoint>& coarseKeyPoints, int part, int edge, float scale, int frame,
+					   vector<uchar>& gate)
+{
+	gate.assign(blocks.cols*blocks.rows, 0);
+	for (int by=0; by<blocks.rows; by++)
+		for (int bx=0; bx<blocks.cols; bx++)
+			gate[by*blocks.cols+bx] = (bx + 3*by + frame) % explorationStride == 0;
+
+	for (size_t i=0; i<coarseKeyPoints.size(); i++)
+	{
+		if (coarseKeyPoints[i].class_id != part)
+			continue;
+
+		float x = (coarseKeyPoints[i].pt.x - edge + 1)*scale + edge - 1;
+		float y = (coarseKeyPoints[i].pt.y - edge)*scale + edge;
+		int bx = cvFloor(x) / blocks.size;
+		int by = cvFloor(y) / blocks.size;
+		for (int v=std::max(by-1, 0); v<=std::min(by+1, blocks.rows-1); v++)
+			for (int u=std::max(bx-1, 0); u<=std::min(bx+1, blocks.cols-1); u++)
+				gate[v*blocks.cols+u] = 1;
+	}
+
+	for (size_t i=0; i<gate.size(); i++)
+		blocks.active[i] &= gate[i];
+}
+
+// the tiles of the smoothing of a part
+static const int smoothingTileSize = 16;
+// the share of active tiles above which the whole part is smoothed
+static const float sparseSmoothingRatio = 0.5f;
+
+// mark the tiles of a part within reach of the pattern of its features, returns
+// the number of active tiles
+static int markPatchTiles(BlockMask& tiles, const vector<KeyPoint>& kps, int part, const Mat& img, int reach)
+{
+	tiles.size = smoothingTileSize;
+	tiles.cols = (img.cols + tiles.size - 1) / tiles.size;
+	tiles.rows = (img.rows + tiles.size - 1) / tiles.size;
+	tiles.active.assign(tiles.cols*tiles.rows, 0);
+
+	int n = 0;
+	for (size_t i=0; i<kps.size(); i++)
+	{
+		if (kps[i].class_id != part)
+			continue;
+
+		int x = cvRound(kps[i].pt.x), y = cvRound(kps[i].pt.y);
+		int bx0 = std::max(x - reach, 0) / tiles.size, bx1 = std::min((x + reach) / tiles.size, tiles.cols-1);
+		int by0 = std::max(y - reach, 0) / tiles.size, by1 = std::min((y + reach) / tiles.size, tiles.rows-1);
+		for (int v=by0; v<=by1; v++)
+			for (int u=bx0; u<=bx1; u++)
+				if (!tiles.active[v*tiles.cols+u])
+				{
+					tiles.active[v*tiles.cols+u] = 1;
+					n++;
+				}
+	}
+	return n;
+}
+
+// the number of corners the adaptive threshold aims at, relative to the level budget
+static const float adaptiveCandidateRatio = 2.0f;
+
+// the range of the adaptive threshold
+static const int adaptiveMinBarrier = 5;
+static const int adaptiveMaxBarrier = 120;
+
+// adjust the threshold of a level from the number of corners it has just produced,
+// the change is damped and bounded so that the threshold settles over a few frames
+static void adaptBarrier(int& b, int detected, int desired)
+{
+	float target = desired * adaptiveCandidateRatio;
+	float ratio = (detected + 1.0f) / (target + 1.0f);
+	if (ratio > 0.8f && ratio < 1.25f)
+		return;
+
+	float gain = std::max(0.67f, std::min(1.5f, sqrt(ratio)));
+	int nb = cvRound(b * gain);
+	if (nb == b)
+		nb += ratio > 1.0f ? 1 : -1;
+
+	b = std::max(adaptiveMinBarrier, std::min(adaptiveMaxBarrier, nb));
+}
+
+// a matrix on the memory of buffer, which grows to the largest matrix asked for, so
+// that the matrices of all the levels share it
+static Mat scratchMat(Mat& buffer, int rows, int cols, int type)
+{
+	size_t size = (size_t)rows*cols*CV_ELEM_SIZE(type);
+	if (buffer.total() < size)
+		buffer.create(1, (int)size, CV_8UC1);
+	return Mat(rows, cols, type, buffer.data);
+}
+
+struct SPHORB::Workspace
+{
+	// the number of features of every level
+	vector<int> nfeaturesPerLevel;
+
+	// the gray image, the descriptors when they are not written in place, and the
+	// buffers of the resized spherical image, the parts of the storage grid, the
+	// extended parts, the smoothed parts and their integral images of a level
+	Mat gray;
+	Mat descriptors;
+	Mat imageBuffer;
+	Mat gridBuffers[5], partBuffers[5], smoothedBuffers[5], integralBuffers[5];
+
+	// the key points of a level and of the coarser one, and the moment vectors
+	KeyPointHeap heap;
+	vector<KeyPoint> coarseKeyPoints;
+	vector<Point2f> moments;
+
+	// the scratch of the detection, the selection and the smoothing
+	NonmaxBuffer nonmax;
+	ContrastBuffer contrast;
+	BlockMask blocks;
+	vector<uchar> gate;
+	CellBuffer cellBuffer;
+	BlockMask smoothingTiles;
+
+	Workspace(int nfeatures, int nlevels)
+	{
+		// compute how many features should be detected on every scale space level
+		nfeaturesPerLevel.resize(nlevels);
+		float factor = (float)(1.0 / pow(2.0, 1/3.0));
+		float ndesiredFeaturesPerScale = nfeatures*(1 - factor)/(1 - (float)pow((double)factor, (double)nlevels));
+
+		int sumFeatures = 0;
+		for( int level = 0; level < nlevels-1; level++ )
+		{
+			nfeaturesPerLevel[level] = cvRound(ndesiredFeaturesPerScale);
+			sumFeatures += nfeaturesPerLevel[level];
+			ndesiredFeaturesPerScale *= factor;
+		}
+		nfeaturesPerLevel[nlevels-1] = std::max(nfeatures - sumFeatures, 0);
+	}
+
+	// the matrices of a level on the buffers, which the functions filling them
+	// then do not reallocate
+	void prepareLevel(int level, Mat& image, Mat grid[5], Mat subImg[5], Mat smoothed[5], Mat integrals[5])
+	{
+		int c = cells[level];
+		int edge = SFAST_EDGE + SPHORB_EDGE;
+		image = scratchMat(imageBuffer, c*5/2, c*5, CV_8UC1);
+		for (int i=0;i<5;i++)
+		{
+			grid[i] = scratchMat(gridBuffers[i], c+1, 2*c+1, CV_8UC1);
+			subImg[i] = scratchMat(partBuffers[i], c+2*edge, 2*c+2*edge, CV_8UC1);
+			smoothed[i] = scratchMat(smoothedBuffers[i], c+2*edge, 2*c+2*edge, CV_8UC1);
+			integrals[i] = scratchMat(integralBuffers[i], c+2*edge+2*BOX_PAD+1, 2*c+2*edge+2*BOX_PAD+1, CV_32S);
+		}
+	}
+};
 
-SPHORB::SPHORB(int _nfeatures, int _nlevels, int b): nfeatures(_nfeatures), barrier(b)
+SPHORB::SPHORB(int _nfeatures, int _nlevels, int b, int _flags, int _bytes):
+	barrier(b), nfeatures(_nfeatures), flags(_flags), bytes(_bytes), frameCount(0)
 {
+	CV_Assert(bytes == 16 || bytes == kMaxBytes);
+
 	initSORB();
 	nlevels = min(_nlevels, levels);
+	levelBarriers.assign(nlevels, barrier);
+	workspace = new Workspace(nfeatures, nlevels);
+}
+
+SPHORB::SPHORB(const SPHORB& other):
+	barrier(other.barrier), nfeatures(other.nfeatures), nlevels(other.nlevels), flags(other.flags), bytes(other.bytes),
+	levelBarriers(other.levelBarriers), frameCount(other.frameCount)
+{
+	initSORB();
+	workspace = new Workspace(nfeatures, nlevels);
+}
+
+SPHORB& SPHORB::operator=(const SPHORB& other)
+{
+	if (this != &other)
+	{
+		barrier = other.barrier;
+		nfeatures = other.nfeatures;
+		nlevels = other.nlevels;
+		flags = other.flags;
+		bytes = other.bytes;
+		levelBarriers = other.levelBarriers;
+		frameCount = other.frameCount;
+		delete workspace;
+		workspace = new Workspace(nfeatures, nlevels);
+	}
+	return *this;
 }
 
 SPHORB::~SPHORB()
 {
+	delete workspace;
 	uninitSORB();
 }
 
+size_t SphericalFeatures::size() const
+{
+	return responses.size();
+}
+
+void SphericalFeatures::clear()
+{
+	bearings.clear();
+	points.clear();
+	responses.clear();
+	moments.clear();
+	levels.clear();
+	// the rows go but the buffer stays, for the next image
+	descriptors.resize(0);
+}
+
+void SphericalFeatures::append(const vector<KeyPoint>& kps, const vector<Point2f>& levelMoments)
+{
+	for (size_t i=0; i<kps.size(); i++)
+	{
+		points.push_back(kps[i].pt);
+		responses.push_back(kps[i].response);
+		moments.push_back(levelMoments[i]);
+		levels.push_back(kps[i].octave);
+	}
+}
+
+float SphericalFeatures::angle(size_t i) const
+{
+	return fastAtan2(moments[i].y, moments[i].x);
+}
+
+KeyPoint SphericalFeatures::keyPoint(size_t i) const
+{
+	float scale = float(cells[0])/float(cells[levels[i]]);
+	return KeyPoint(points[i], 31.0f*scale, angle(i), responses[i], levels[i], -1);
+}
+
+void SphericalFeatures::toKeyPoints(vector<KeyPoint>& keypoints) const
+{
+	keypoints.resize(size());
+	for (size_t i=0; i<keypoints.size(); i++)
+		keypoints[i] = keyPoint(i);
+}
+
 int SPHORB::descriptorSize() const
 {
-    return kBytes;
+    return bytes;
 }
 
 int SPHORB::descriptorType() const
@@ -772,8 +1575,34 @@ int SPHORB::descriptorType() const
     return CV_8U;
 }
 
+int SPHORB::descriptorVersion() const
+{
+	int scheme = (flags & BOX_DESCRIPTOR) ? DESCRIPTOR_BOXES : DESCRIPTOR_POINTS;
+	return scheme << 8 | PATTERN_REVISION;
+}
+
 void SPHORB::operator()(InputArray _image, InputArray _mask, vector<KeyPoint>& _keypoints,
                       OutputArray _descriptors, bool useProvidedKeypoints) const
+{
+	detectAndCompute(_image, _mask, _keypoints, _descriptors, useProvidedKeypoints, NULL, NULL, NULL);
+}
+
+void SPHORB::operator()(InputArray _image, InputArray _mask, vector<KeyPoint>& _keypoints, OutputArray _descriptors,
+                      vector<Point3f>& bearings, vector<Point2f>& imagePoints) const
+{
+	detectAndCompute(_image, _mask, _keypoints, _descriptors, false, &bearings, &imagePoints, NULL);
+}
+
+void SPHORB::operator()(InputArray _image, InputArray _mask, SphericalFeatures& features) const
+{
+	vector<KeyPoint> keypoints;
+	features.clear();
+	detectAndCompute(_image, _mask, keypoints, features.descriptors, false, &features.bearings, NULL, &features);
+}
+
+void SPHORB::detectAndCompute(InputArray _image, InputArray _mask, vector<KeyPoint>& _keypoints, OutputArray _descriptors,
+                      bool useProvidedKeypoints, vector<Point3f>* bearings, vector<Point2f>* imagePoints,
+                      SphericalFeatures* features) const
 {
 	bool do_keypoints = !useProvidedKeypoints;
     bool do_descriptors = _descriptors.needed();
@@ -782,105 +1611,203 @@ void SPHORB::operator()(InputArray _image, InputArray _mask, vector<KeyPoint>& _
         return;
 	
 	_keypoints.clear();
+	_keypoints.reserve(features ? 0 : nfeatures);
+	if (bearings)
+		bearings->clear();
+	if (imagePoints)
+		imagePoints->clear();
+	Workspace& ws = *workspace;
 	Mat temp = _image.getMat();
-	Mat descriptors;
     if( temp.type() != CV_8UC1 )
-        cvtColor(_image, temp, CV_BGR2GRAY);
-
-	// compute how many features should be detected on every scale space level
-	vector<int> nfeaturesPerLevel(nlevels);
-	float factor = (float)(1.0 / pow(2.0, 1/3.0));
-	float ndesiredFeaturesPerScale = nfeatures*(1 - factor)/(1 - (float)pow((double)factor, (double)nlevels));
-
-	int sumFeatures = 0;
-	for( int level = 0; level < nlevels-1; level++ )
+    {
+        cvtColor(_image, ws.gray, CV_BGR2GRAY);
+        temp = ws.gray;
+    }
+
+	const vector<int>& nfeaturesPerLevel = ws.nfeaturesPerLevel;
+
+	// The descriptors of every level are written in place into the output, sized once
+	// for the budgets of the levels, which bound the features of every level. An output
+	// matrix owning its whole buffer alone is reused while it has the capacity; one
+	// sharing its buffer with another matrix is given a new one. A slot of the caller, a
+	// submatrix or a matrix on external data, is written without being reallocated and
+	// holds all the features when it has as many rows as the budgets.
+	bool inPlace = _descriptors.needed() && _descriptors.kind() == _InputArray::MAT;
+	Mat& descriptors = inPlace ? _descriptors.getMatRef() : ws.descriptors;
+	bool slot = descriptors.isSubmatrix() || (descriptors.data && !descriptors.refcount);
+
+	int budget = 0;
+	for (int level = 0; level < nlevels; level++)
+		budget += nfeaturesPerLevel[level];
+	if (slot)
+		CV_Assert(descriptors.type() == CV_8UC1 && descriptors.cols == bytes);
+	else
 	{
-		nfeaturesPerLevel[level] = cvRound(ndesiredFeaturesPerScale);
-		sumFeatures += nfeaturesPerLevel[level];
-		ndesiredFeaturesPerScale *= factor;
+		if (descriptors.refcount && *descriptors.refcount > 1)
+			descriptors.release();
+		if (descriptors.type() == CV_8UC1 && descriptors.cols == bytes)
+			descriptors.resize(budget);
+		else
+			descriptors.create(budget, bytes, CV_8UC1);
 	}
-	nfeaturesPerLevel[nlevels-1] = std::max(nfeatures - sumFeatures, 0);
+	int ndescriptors = 0;
 
-	// Gaussian kernel for hexagonal grid
-	Mat matKernel(7, 7, CV_64F, kernel);
+	// the features of the coarser level in its grid coordinates, when detecting coarse to fine
+	vector<KeyPoint>& coarseKeyPoints = ws.coarseKeyPoints;
+	coarseKeyPoints.clear();
 
-	// sampling pattern
-	const int npoints = 512;
-	vector<Point> pattern;
-	const Point* pattern0 = (const Point*)bit_pattern;
-
-	std::copy(pattern0, pattern0 + 512, std::back_inserter(pattern));
-	
+	// the moment vector of every feature of a level
+	vector<Point2f>& levelMoments = ws.moments;
+	// the tiles smoothed when the features are sparse
+	BlockMask& smoothingTiles = ws.smoothingTiles;
 
-	// detect and describe the features on every level
-	for (int l=0;l<nlevels;l++)
+	// detect and describe the features on every level, from the coarsest one
+	// if the finer levels are only searched around the coarser features
+	for (int k=0;k<nlevels;k++)
 	{
-		// resize the spherical image
-		Size sz(cells[l]*5, cells[l]*5/2);
-		Mat image(sz, temp.type());
-		resize(temp, image, sz, 0, 0, CV_INTER_AREA);
+		int l = (flags & COARSE_TO_FINE) ? nlevels-1-k : k;
+
+		// the resized spherical image, its five parts and the extended ones, the smoothed
+		// parts and the padded integral images of the parts for the box descriptor
+		Mat image;
+		Mat grid[5], subImg[5], smoothed[5], integrals[5];
+		ws.prepareLevel(l, image, grid, subImg, smoothed, integrals);
+		buildStorageGrid(temp, l, image, grid, subImg, SFAST_EDGE + SPHORB_EDGE);
+
+		// the key points on each level, only the strongest ones are kept as they are
+		// detected unless the selection is done per cell afterwards
+		KeyPointHeap& levelHeap = ws.heap;
+		levelHeap.reset((flags & SPHERE_BUCKETING) ? -1 : nfeaturesPerLevel[l]);
+
+		int levelBarrier = (flags & ADAPTIVE_THRESHOLD) ? levelBarriers[l] : barrier;
+		CornerDetectSpan detect = (flags & AGAST_DETECTOR) ? agast_corner_detect_span : sfast_corner_detect_span;
+		BlockMask& blocks = ws.blocks;
+		bool gated = (flags & COARSE_TO_FINE) && k > 0;
+		bool useBlocks = (flags & BLOCK_SKIPPING) || gated;
 
-		// split the spherical image to five parts
-		Mat subImg[5];
-		for(int i=0;i<5;i++)
+		for (int i=0;i<5;i++)
 		{
-			subImg[i].create(Size(2*cells[l]+1, cells[l]+1), image.type());
-			splitSphere2(image, subImg[i], i, imgInfos[l][i]);
-		}
-
-		// extend each part for boundary pixels 
-		extendEdge(subImg[0], subImg[1], subImg[2], subImg[3], subImg[4], SFAST_EDGE + SPHORB_EDGE);
+			// skip the blocks without enough contrast for a corner
+			if (flags & BLOCK_SKIPPING)
+				buildContrastMask(&subImg[i].at<uchar>(0,0), (int)subImg[i].step, maskSpans[l], levelBarrier,
+								  contrastBlockSize, blocks, &ws.contrast);
+			else if (gated)
+			{
+				blocks.size = contrastBlockSize;
+				blocks.cols = (subImg[i].cols + contrastBlockSize - 1)/contrastBlockSize;
+				blocks.rows = (subImg[i].rows + contrastBlockSize - 1)/contrastBlockSize;
+				blocks.active.assign(blocks.cols*blocks.rows, 1);
+			}
 
-		// the key points on each level
-		vector<KeyPoint> levelKeyPoints;
+			// search only around the features of the coarser level
+			if (gated)
+				gateBlocks(blocks, coarseKeyPoints, i, SFAST_EDGE + SPHORB_EDGE, float(cells[l])/float(cells[l+1]), frameCount, ws.gate);
 
-		for (int i=0;i<5;i++)
-		{
-			xy* corners;
-			int* score;
-			int cor_num;
-			vector<KeyPoint> partKeyPoints;
-
-			// detect the key points and do the non-max suppression
-			corners = sfast_corner_detect(&subImg[i].at<uchar>(0,0), &maskes[l].at<uchar>(0,0), 
-							maskes[l].cols, (int)maskes[l].step, maskes[l].rows, barrier, &cor_num);
-			score = sfastScore(&subImg[i].at<uchar>(0,0), (int)subImg[i].step, corners, cor_num, barrier);
-			sfastNonmaxSuppression(corners, score, cor_num, partKeyPoints, i);
-
-			levelKeyPoints.insert(levelKeyPoints.end(), partKeyPoints.begin(), partKeyPoints.end());
-			
-			delete[] corners;
-			delete[] score;
+			// detect the key points and do the non-max suppression in one pass
+			sfastDetectNonmax(&subImg[i].at<uchar>(0,0), (int)subImg[i].step, maskSpans[l], levelBarrier, levelHeap, i,
+							  detect, useBlocks ? &blocks : NULL, &ws.nonmax);
 		}
 
-		if (levelKeyPoints.size()>nfeaturesPerLevel[l])
-			KeyPointsFilter::retainBest(levelKeyPoints, nfeaturesPerLevel[l]);
+		// the threshold for the next frame; a gated level keeps its threshold, as its
+		// corners are only counted around the coarser features and would drive it down
+		if ((flags & ADAPTIVE_THRESHOLD) && !gated)
+			adaptBarrier(levelBarriers[l], levelHeap.pushed(), nfeaturesPerLevel[l]);
 
-		// compute the orientation
-		for(size_t i=0;i<levelKeyPoints.size();i++)
-			levelKeyPoints[i].angle = IC_Angle(subImg[levelKeyPoints[i].class_id], SPHORB_EDGE, levelKeyPoints[i].pt, geoinfos[l]);
+		vector<KeyPoint>& levelKeyPoints = levelHeap.keypoints();
+		if (flags & SPHERE_BUCKETING)
+			retainBestPerCell(levelKeyPoints, nfeaturesPerLevel[l], maskSpans[l], SFAST_EDGE + SPHORB_EDGE, l, ws.cellBuffer);
+		if (flags & COARSE_TO_FINE)
+			coarseKeyPoints = levelKeyPoints;
 
-		// filter the image
-		for (int i=0;i<5;i++)
-			filter2D(subImg[i], subImg[i], -1, matKernel);
+		// compute the orientation as the moment vector, which selects the rotated pattern
+		// of the descriptor
+		levelMoments.resize(levelKeyPoints.size());
+		for(size_t i=0;i<levelKeyPoints.size();i++)
+			levelMoments[i] = IC_Moments(subImg[levelKeyPoints[i].class_id], hexPatches[l], levelKeyPoints[i].pt);
 
-		Mat tDesc = Mat::zeros(levelKeyPoints.size(), kBytes, CV_8UC1);
+		int n = (int)levelKeyPoints.size();
+		if (ndescriptors + n > descriptors.rows)
+			CV_Error(CV_StsOutOfRange, "the descriptor slot has too few rows for the features");
+		Mat tDesc = descriptors.rowRange(ndescriptors, ndescriptors + n);
+		ndescriptors += n;
 
-		for(size_t i=0;i<levelKeyPoints.size();i++)
+		if (flags & BOX_DESCRIPTOR)
 		{
-			computeOrbDescriptor(levelKeyPoints[i], subImg[levelKeyPoints[i].class_id], &pattern[0], tDesc.ptr((int)i), kBytes);
+			// the integral images of the parts holding features
+			for (int i=0;i<5;i++)
+			{
+				bool used = false;
+				for (size_t j=0;j<levelKeyPoints.size() && !used;j++)
+					used = levelKeyPoints[j].class_id == i;
+				if (used)
+					boxIntegral(subImg[i], integrals[i], BOX_PAD);
+			}
+
+			computeBoxDescriptors(levelKeyPoints, levelMoments, integrals, rotatedPatterns[l], tDesc, bytes);
 		}
+		else
+		{
+			// smooth the parts with the hexagonal gaussian, only around the features
+			// where they are sparse
+			for (int i=0;i<5;i++)
+			{
+				int active = markPatchTiles(smoothingTiles, levelKeyPoints, i, subImg[i], SFAST_EDGE + SPHORB_EDGE);
+				if (active > sparseSmoothingRatio * smoothingTiles.active.size())
+					hexGaussianBlur(subImg[i], smoothed[i]);
+				else
+					hexGaussianBlurTiles(subImg[i], smoothed[i], smoothingTiles);
+			}
 
-		descriptors.push_back(tDesc);
+			computeOrbDescriptors(levelKeyPoints, levelMoments, smoothed, rotatedPatterns[l], tDesc, bytes);
+		}
 
-		mappingKeypoint(image, levelKeyPoints, SFAST_EDGE + SPHORB_EDGE, geoinfos[l], l);
+		mappingKeypoint(levelKeyPoints, SFAST_EDGE + SPHORB_EDGE, gridPositions[l], geoinfos[l], l, temp.size(), bearings, imagePoints);
 
-		_keypoints.insert(_keypoints.end(), levelKeyPoints.begin(), levelKeyPoints.end());
+		// the features keep the moment vectors, the angles of the orientations are only
+		// computed for the keypoints returned
+		if (features)
+			features->append(levelKeyPoints, levelMoments);
+		else
+		{
+			for(size_t i=0;i<levelKeyPoints.size();i++)
+				levelKeyPoints[i].angle = fastAtan2(levelMoments[i].y, levelMoments[i].x);
+			_keypoints.insert(_keypoints.end(), levelKeyPoints.begin(), levelKeyPoints.end());
+		}
 
 	}
 
-	descriptors.copyTo(_descriptors);
+	descriptors.resize(ndescriptors);
+	if (!inPlace)
+		descriptors.copyTo(_descriptors);
+	frameCount++;
+
+}
+
+void SPHORB::storageGrid(InputArray _image, int level, vector<Mat>& parts, Mat& mask) const
+{
+	CV_Assert(level >= 0 && level < levels);
 
+	Mat temp = _image.getMat();
+	if( temp.type() != CV_8UC1 )
+		cvtColor(_image, temp, CV_BGR2GRAY);
+
+	Mat image;
+	Mat grid[5], subImg[5];
+	buildStorageGrid(temp, level, image, grid, subImg, SFAST_EDGE + SPHORB_EDGE);
+	parts.assign(subImg, subImg + 5);
+
+	// the pixels visited by the detector
+	const MaskSpans& spans = maskSpans[level];
+	mask = Mat::zeros(spans.rows, spans.cols, CV_8UC1);
+	for (int y=0; y<spans.rows; y++)
+		for (int s=spans.rowStart[y]; s<spans.rowStart[y+1]; s++)
+			memset(mask.ptr<uchar>(y) + spans.spans[s][0], 255, spans.spans[s][1] - spans.spans[s][0]);
+}
+
+void SPHORB::smoothPart(const Mat& part, Mat& smoothed) const
+{
+	CV_Assert(part.type() == CV_8UC1);
+	hexGaussianBlur(part, smoothed);
 }
 
 void SPHORB::operator()(InputArray image, InputArray mask, vector<KeyPoint>& keypoints) const
@@ -0,0 +1,7163 @@
+/*
+	AUTHOR:
+	Qiang Zhao, email: qiangzhao@tju.edu.cn
+	Copyright (C) 2015 Tianjin University
+	School of Computer Software
+	School of Computer Science and Technology
+
+	LICENSE:
+	SPHORB is distributed under the GNU General Public License.  For information on 
+	commercial licensing, please contact the authors at the contact address below.
+
+	REFERENCE:
+	@article{zhao-SPHORB,
+	author   = {Qiang Zhao and Wei Feng and Liang Wan and Jiawan Zhang},
+	title    = {SPHORB: A Fast and Robust Binary Feature on the Sphere},
+	journal  = {International Journal of Computer Vision},
+	year     = {2015},
+	volume   = {113},
+	number   = {2},
+	pages    = {143-159},
+	}
+
+	
+	Automatically generated code using the scheme of Rosten and Drummond
+	E. Rosten and T. Drummond. Machine learning for highspeed corner detection. 
+	In Proceedings of the European Conference on Computer Vision (ECCV), 2006.
+
+
+	Parameters:
+	branch_layout = labels
+	profile_order = 0
+	adaptive_trees = 2
+	corner_pointers = 2
+	force_first_question = -1
+	corner_type = 10
+	barrier = 25
+
+	Data:
+	Number of frames:    0
+	Similar ratio:       0.7 0.1
+	Potential features:  4000000
+	Real features:       13626
+	Questions per pixel: 4.21445
+*/
+
+#include "detector.h"
+
+// detect the corners on the run [xbegin, xend) of row y, writing their x coordinates to xs
+int agast_corner_detect_span(const byte* im, int xstride, int y, int xbegin, int xend, int barrier, int* xs)
+{
+	int cb, c_b;
+	const byte  *line_max, *line_min;
+	int			total=0;
+	const byte* cache_0;
+	const byte* cache_1;
+	const byte* cache_2;
+	int	pixel[18];
+
+	pixel[0] = 0 + 3 * xstride;
+	pixel[1] = 1 + 2 * xstride;
+	pixel[2] = 2 + 1 * xstride;
+	pixel[3] = 3 + 0 * xstride;
+	pixel[4] = 3 + -1 * xstride;
+	pixel[5] = 3 + -2 * xstride;
+	pixel[6] = 3 + -3 * xstride;
+	pixel[7] = 2 + -3 * xstride;
+	pixel[8] = 1 + -3 * xstride;
+	pixel[9] = 0 + -3 * xstride;
+	pixel[10] = -1 + -2 * xstride;
+	pixel[11] = -2 + -1 * xstride;
+	pixel[12] = -3 + 0 * xstride;
+	pixel[13] = -3 + 1 * xstride;
+	pixel[14] = -3 + 2 * xstride;
+	pixel[15] = -3 + 3 * xstride;
+	pixel[16] = -2 + 3 * xstride;
+	pixel[17] = -1 + 3 * xstride;
+	line_min = im + y*xstride;
+	line_max = line_min + xend;
+	cache_0 = line_min + xbegin - 1;
+
+	cache_1 = cache_0 + pixel[8];
+	cache_2 = cache_0 + pixel[0];
+
+	homogeneous:
+	cache_0++;
+	cache_1++;
+	cache_2++;
+	if(cache_0 >= line_max)
+		return total;
+	cb = *cache_0 + barrier;
+	c_b = *cache_0 - barrier;
+	goto node_466;
+
+	success:
+	xs[total++] = (int)(cache_0-line_min);
+	structured:
+	cache_0++;
+	cache_1++;
+	cache_2++;
+	if(cache_0 >= line_max)
+		return total;
+	cb = *cache_0 + barrier;
+	c_b = *cache_0 - barrier;
+		if(*cache_1 > cb)
+			goto node_1152;
+		if(*cache_1 < c_b)
+			goto node_1939;
+		if(*(cache_2+-2) > cb)
+			goto node_1979;
+		if(*(cache_2+-2) < c_b)
+			goto node_2018;
+		goto homogeneous;
+	node_1979:
+		if(*cache_2 > cb)
+			goto node_1978;
+		if(*cache_2 < c_b)
+			goto structured;
+		goto homogeneous;
+	node_1978:
+		if(*(cache_2+-1) > cb)
+			goto node_1977;
+		if(*(cache_2+-1) < c_b)
+			goto structured;
+		goto homogeneous;
+	node_1977:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1964;
+		if(*(cache_0 + pixel[1]) < c_b)
+			goto node_1970;
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_1975;
+		if(*(cache_0 + pixel[11]) < c_b)
+			goto structured;
+		goto homogeneous;
+	node_1975:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_1974;
+		goto structured;
+	node_1974:
+		if(*(cache_2+-3) > cb)
+			goto node_1973;
+		goto structured;
+	node_1973:
+		if(*(cache_1+-1) > cb)
+			goto node_1972;
+		goto structured;
+	node_1972:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_1971;
+		goto structured;
+	node_1971:
+		if(*(cache_0+-3) > cb)
+			goto node_19;
+		goto structured;
+	node_19:
+		if(*(cache_0 + pixel[10]) > cb)
+			goto success;
+		goto structured;
+	node_1964:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1954;
+		if(*(cache_0 + pixel[2]) < c_b)
+			goto node_1959;
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_1962;
+		goto structured;
+	node_1962:
+		if(*(cache_0+-3) > cb)
+			goto node_1961;
+		goto structured;
+	node_1961:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_1960;
+		goto structured;
+	node_1960:
+		if(*(cache_0 + pixel[10]) > cb)
+			goto node_114;
+		goto structured;
+	node_114:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_82;
+		goto structured;
+	node_82:
+		if(*(cache_2+-3) > cb)
+			goto success;
+		goto structured;
+	node_1954:
+		if(*(cache_2+-3) > cb)
+			goto node_1948;
+		if(*(cache_2+-3) < c_b)
+			goto node_1951;
+		if(*(cache_0+3) > cb)
+			goto node_1952;
+		goto structured;
+	node_1952:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1391;
+		goto structured;
+	node_1391:
+		if(*(cache_1+2) > cb)
+			goto node_1390;
+		goto structured;
+	node_1390:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_35;
+		goto structured;
+	node_35:
+		if(*(cache_1+1) > cb)
+			goto success;
+		goto structured;
+	node_1948:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_1943;
+		if(*(cache_0 + pixel[14]) < c_b)
+			goto node_1945;
+		if(*(cache_1+2) > cb)
+			goto node_1946;
+		goto structured;
+	node_1946:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_253;
+		goto structured;
+	node_253:
+		if(*(cache_0+3) > cb)
+			goto node_252;
+		goto structured;
+	node_252:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto success;
+		goto structured;
+	node_1943:
+		if(*(cache_0+3) > cb)
+			goto node_1940;
+		if(*(cache_0+3) < c_b)
+			goto node_1941;
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_1085;
+		goto structured;
+	node_1085:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_8;
+		goto structured;
+	node_8:
+		if(*(cache_0+-3) > cb)
+			goto success;
+		goto structured;
+	node_1940:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_122;
+	node_104:
+		if(*(cache_0+-3) > cb)
+			goto node_103;
+		goto structured;
+	node_103:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto success;
+		goto structured;
+	node_122:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto success;
+		goto node_103;
+	node_1941:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_1867;
+		goto structured;
+	node_1867:
+		if(*(cache_0+-3) > cb)
+			goto node_24;
+		goto structured;
+	node_24:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto success;
+		goto structured;
+	node_1945:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1944;
+		goto structured;
+	node_1944:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_665;
+		goto structured;
+	node_665:
+		if(*(cache_0+3) > cb)
+			goto node_68;
+		goto structured;
+	node_68:
+		if(*(cache_1+2) > cb)
+			goto success;
+		goto structured;
+	node_1951:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1950;
+		goto structured;
+	node_1950:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_1949;
+		goto structured;
+	node_1949:
+		if(*(cache_1+1) > cb)
+			goto node_1883;
+		goto structured;
+	node_1883:
+		if(*(cache_1+2) > cb)
+			goto node_541;
+		goto structured;
+	node_541:
+		if(*(cache_0+3) > cb)
+			goto success;
+		goto structured;
+	node_1959:
+		if(*(cache_2+-3) > cb)
+			goto node_1958;
+		goto structured;
+	node_1958:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_1957;
+		goto structured;
+	node_1957:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_1956;
+		goto structured;
+	node_1956:
+		if(*(cache_0+-3) > cb)
+			goto node_1955;
+		goto structured;
+	node_1955:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_19;
+		goto structured;
+	node_1970:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_1969;
+		goto structured;
+	node_1969:
+		if(*(cache_0+-3) > cb)
+			goto node_1968;
+		goto structured;
+	node_1968:
+		if(*(cache_0 + pixel[10]) > cb)
+			goto node_1967;
+		goto structured;
+	node_1967:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_1966;
+		goto structured;
+	node_1966:
+		if(*(cache_2+-3) > cb)
+			goto node_1965;
+		goto structured;
+	node_1965:
+		if(*(cache_1+-1) > cb)
+			goto node_24;
+		goto structured;
+	node_2018:
+		if(*(cache_2+-1) > cb)
+			goto structured;
+		if(*(cache_2+-1) < c_b)
+			goto node_2017;
+		goto homogeneous;
+	node_2017:
+		if(*cache_2 > cb)
+			goto structured;
+		if(*cache_2 < c_b)
+			goto node_2016;
+		goto homogeneous;
+	node_2016:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1984;
+		if(*(cache_0 + pixel[1]) < c_b)
+			goto node_2009;
+		if(*(cache_0 + pixel[13]) > cb)
+			goto structured;
+		if(*(cache_0 + pixel[13]) < c_b)
+			goto node_2014;
+		goto homogeneous;
+	node_2014:
+		if(*(cache_0 + pixel[10]) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_1+-1) >= c_b)
+			goto structured;
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+	node_216:
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		goto success;
+	node_1984:
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_1+-1) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[10]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+	node_807:
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+	node_350:
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		goto success;
+	node_2009:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1988;
+		if(*(cache_0 + pixel[2]) < c_b)
+			goto node_2003;
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+	node_391:
+		if(*(cache_0 + pixel[10]) >= c_b)
+			goto structured;
+		goto success;
+	node_1988:
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+	node_1127:
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		goto node_391;
+	node_2003:
+		if(*(cache_0+3) > cb)
+			goto node_1991;
+		if(*(cache_0+3) < c_b)
+			goto node_1999;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		goto node_807;
+	node_1991:
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+	node_819:
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+	node_319:
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		goto success;
+	node_1999:
+		if(*(cache_2+-3) > cb)
+			goto node_1994;
+		if(*(cache_2+-3) < c_b)
+			goto node_1996;
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+		if(*(cache_1+2) >= c_b)
+			goto structured;
+	node_1992:
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+	node_296:
+		if(*(cache_1+1) >= c_b)
+			goto structured;
+		goto success;
+	node_1994:
+		if(*(cache_1+2) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+		goto node_1992;
+	node_1996:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_982;
+		if(*(cache_0 + pixel[14]) < c_b)
+			goto node_1995;
+	node_686:
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+		if(*(cache_1+2) >= c_b)
+			goto structured;
+	node_152:
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+		goto success;
+	node_982:
+		if(*(cache_1+2) >= c_b)
+			goto structured;
+	node_740:
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+	node_214:
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+		goto success;
+	node_1995:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_740;
+		if(*(cache_0 + pixel[13]) < c_b)
+			goto node_683;
+	node_210:
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+		goto node_152;
+	node_683:
+		if(*(cache_0+-3) >= c_b)
+			goto node_214;
+		goto success;
+	node_1152:
+		if(*(cache_1+-1) > cb)
+			goto node_994;
+		if(*(cache_1+-1) < c_b)
+			goto node_1073;
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1120;
+		if(*(cache_0 + pixel[1]) < c_b)
+			goto node_1150;
+		goto homogeneous;
+	node_1120:
+		if(*(cache_2+-1) > cb)
+			goto node_1119;
+		if(*(cache_2+-1) < c_b)
+			goto structured;
+		goto homogeneous;
+	node_1119:
+		if(*cache_2 > cb)
+			goto node_1118;
+		goto structured;
+	node_1118:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1104;
+		if(*(cache_0 + pixel[2]) < c_b)
+			goto node_1110;
+		if(*(cache_0+3) > cb||*(cache_0+3) < c_b)
+			goto node_1111;
+		if(*(cache_0 + pixel[5]) > cb||*(cache_0 + pixel[5]) < c_b)
+			goto node_1111;
+		if(*(cache_0 + pixel[10]) > cb)
+			goto node_1114;
+		if(*(cache_0 + pixel[10]) < c_b)
+			goto structured;
+		goto homogeneous;
+	node_1114:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_1113;
+		if(*(cache_0 + pixel[13]) < c_b)
+			goto structured;
+		goto homogeneous;
+	node_1113:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_1112;
+		goto structured;
+	node_1112:
+		if(*(cache_0+-3) > cb)
+			goto node_88;
+		goto structured;
+	node_88:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_87;
+		goto structured;
+	node_87:
+		if(*(cache_2+-3) > cb)
+			goto node_66;
+		goto structured;
+	node_66:
+		if(*(cache_2+-2) > cb)
+			goto success;
+		goto structured;
+	node_1111:
+		if(*(cache_0 + pixel[10]) > cb)
+			goto node_1098;
+		goto structured;
+	node_1098:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_259;
+		goto structured;
+	node_259:
+		if(*(cache_0+-3) > cb)
+			goto node_258;
+		goto structured;
+	node_258:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_88;
+		goto structured;
+	node_1104:
+		if(*(cache_0+3) > cb)
+			goto node_1093;
+		if(*(cache_0+3) < c_b)
+			goto node_1097;
+		if(*(cache_0 + pixel[5]) > cb||*(cache_0 + pixel[5]) < c_b)
+			goto node_1098;
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_1101;
+		goto structured;
+	node_1101:
+		if(*(cache_2+-2) > cb)
+			goto node_1100;
+		goto structured;
+	node_1100:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_1099;
+		goto structured;
+	node_1099:
+		if(*(cache_0+-3) > cb)
+			goto node_132;
+		goto structured;
+	node_132:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_82;
+		goto structured;
+	node_1093:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1084;
+		if(*(cache_0 + pixel[4]) < c_b)
+			goto node_1088;
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_1091;
+		goto structured;
+	node_1091:
+		if(*(cache_2+-3) > cb)
+			goto node_1090;
+		goto structured;
+	node_1090:
+		if(*(cache_0+-3) > cb)
+			goto node_1089;
+		goto structured;
+	node_1089:
+		if(*(cache_1+2) >= c_b)
+			goto node_477;
+	node_898:
+		if(*(cache_2+-2) > cb)
+			goto node_108;
+		goto structured;
+	node_108:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto success;
+		goto structured;
+	node_477:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_66;
+		goto structured;
+	node_1084:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_1079;
+		if(*(cache_0 + pixel[5]) < c_b)
+			goto node_1080;
+		if(*(cache_0 + pixel[11]) > cb||*(cache_0 + pixel[11]) < c_b)
+			goto node_258;
+		if(*(cache_1+2) >= c_b)
+			goto node_258;
+		if(*(cache_2+-3) > cb)
+			goto node_559;
+		goto structured;
+	node_559:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_477;
+		goto structured;
+	node_1079:
+		if(*(cache_1+2) > cb)
+			goto node_1074;
+		if(*(cache_1+2) < c_b)
+			goto node_1075;
+		if(*(cache_0 + pixel[10]) >= c_b)
+			goto node_88;
+		if(*(cache_1+1) >= c_b)
+			goto node_88;
+		if(*(cache_2+-3) > cb)
+			goto node_477;
+		goto structured;
+	node_1074:
+		if(*(cache_1+1) > cb)
+			goto success;
+		goto node_87;
+	node_1075:
+		if(*(cache_2+-2) > cb)
+			goto node_114;
+		goto structured;
+	node_1080:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_615;
+		goto structured;
+	node_615:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_87;
+		goto structured;
+	node_1088:
+		if(*(cache_2+-2) > cb)
+			goto node_1087;
+		goto structured;
+	node_1087:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_1086;
+		goto structured;
+	node_1086:
+		if(*(cache_2+-3) > cb)
+			goto node_1085;
+		goto structured;
+	node_1097:
+		if(*(cache_2+-2) > cb)
+			goto node_1096;
+		goto structured;
+	node_1096:
+		if(*(cache_2+-3) > cb)
+			goto node_1095;
+		goto structured;
+	node_1095:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_1094;
+		goto structured;
+	node_1094:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_1085;
+		goto structured;
+	node_1110:
+		if(*(cache_0 + pixel[10]) > cb)
+			goto node_1109;
+		goto structured;
+	node_1109:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_1108;
+		goto structured;
+	node_1108:
+		if(*(cache_2+-3) > cb)
+			goto node_1107;
+		goto structured;
+	node_1107:
+		if(*(cache_2+-2) > cb)
+			goto node_1106;
+		goto structured;
+	node_1106:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_1105;
+		goto structured;
+	node_1105:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_8;
+		goto structured;
+	node_1150:
+		if(*(cache_2+-1) > cb)
+			goto structured;
+		if(*(cache_2+-1) < c_b)
+			goto node_1149;
+		goto homogeneous;
+	node_1149:
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) > cb)
+			goto node_1124;
+		if(*(cache_2+-3) < c_b)
+			goto node_1139;
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_1145;
+	node_345:
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+	node_344:
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+	node_317:
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+	node_316:
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+	node_297:
+		if(*(cache_1+2) >= c_b)
+			goto structured;
+		goto node_296;
+	node_1145:
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_1143;
+		goto node_344;
+	node_1143:
+		if(*(cache_0+-3) > cb)
+			goto node_1142;
+		goto node_344;
+	node_1142:
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		goto node_297;
+	node_1124:
+		if(*(cache_1+1) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+		if(*(cache_1+2) >= c_b)
+			goto structured;
+	node_1051:
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		goto node_214;
+	node_1139:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_1126;
+		if(*(cache_0 + pixel[14]) < c_b)
+			goto node_1134;
+		if(*(cache_0+-3) >= c_b)
+			goto node_455;
+		if(*(cache_0 + pixel[10]) > cb)
+			goto node_455;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+	node_205:
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+	node_173:
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+	node_172:
+		if(*(cache_1+2) >= c_b)
+			goto structured;
+		goto success;
+	node_455:
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+	node_206:
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		goto node_205;
+	node_1126:
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+		if(*(cache_1+2) >= c_b)
+			goto structured;
+	node_1039:
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+	node_674:
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		goto success;
+	node_1134:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1129;
+		if(*(cache_0 + pixel[2]) < c_b)
+			goto node_1132;
+		if(*(cache_0 + pixel[10]) >= c_b)
+			goto structured;
+	node_349:
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+	node_348:
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		goto node_319;
+	node_1129:
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		goto node_1127;
+	node_1132:
+		if(*(cache_0+3) > cb)
+			goto node_1131;
+		if(*(cache_0+3) < c_b)
+			goto node_741;
+		goto node_349;
+	node_1131:
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+	node_405:
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		goto success;
+	node_741:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_740;
+		if(*(cache_0 + pixel[13]) < c_b)
+			goto node_351;
+		goto node_210;
+	node_351:
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto node_350;
+		goto success;
+	node_994:
+		if(*(cache_0 + pixel[10]) > cb)
+			goto node_870;
+		if(*(cache_0 + pixel[10]) < c_b)
+			goto node_945;
+		if(*cache_2 > cb)
+			goto node_976;
+		if(*cache_2 < c_b)
+			goto node_992;
+		goto homogeneous;
+	node_976:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_975;
+		goto structured;
+	node_975:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_974;
+		goto structured;
+	node_974:
+		if(*(cache_0+3) > cb)
+			goto node_960;
+		if(*(cache_0+3) < c_b)
+			goto node_966;
+		if(*(cache_1+1) > cb)
+			goto node_972;
+	node_264:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_263;
+		goto structured;
+	node_263:
+		if(*(cache_0+-3) > cb)
+			goto node_76;
+		goto structured;
+	node_76:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_60;
+		goto structured;
+	node_60:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_6;
+		goto structured;
+	node_6:
+		if(*(cache_2+-3) > cb)
+			goto node_5;
+		goto structured;
+	node_5:
+		if(*(cache_2+-2) > cb)
+			goto node_3;
+		goto structured;
+	node_3:
+		if(*(cache_2+-1) > cb)
+			goto success;
+		goto structured;
+	node_972:
+		if(*(cache_2+-3) > cb)
+			goto node_971;
+		goto structured;
+	node_971:
+		if(*(cache_2+-2) > cb)
+			goto node_970;
+		goto structured;
+	node_970:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_969;
+		goto structured;
+	node_969:
+		if(*(cache_0+-3) > cb)
+			goto node_968;
+		goto structured;
+	node_968:
+		if(*(cache_2+-1) > cb)
+			goto node_967;
+		goto structured;
+	node_967:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_108;
+		goto structured;
+	node_960:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_955;
+		if(*(cache_0 + pixel[4]) < c_b)
+			goto node_959;
+		goto node_263;
+	node_955:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_952;
+		if(*(cache_0 + pixel[5]) < c_b)
+			goto node_954;
+		goto node_76;
+	node_952:
+		if(*(cache_1+2) > cb)
+			goto node_947;
+		if(*(cache_1+2) < c_b)
+			goto node_949;
+		if(*(cache_2+-1) > cb)
+			goto node_950;
+		goto structured;
+	node_950:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_874;
+		goto structured;
+	node_874:
+		if(*(cache_2+-2) > cb)
+			goto node_82;
+		goto structured;
+	node_947:
+		if(*(cache_1+1) > cb)
+			goto success;
+		if(*(cache_2+-3) > cb)
+			goto node_828;
+		goto structured;
+	node_828:
+		if(*(cache_2+-1) > cb)
+			goto node_66;
+		goto structured;
+	node_949:
+		if(*(cache_2+-3) > cb)
+			goto node_948;
+		goto structured;
+	node_948:
+		if(*(cache_2+-1) > cb)
+			goto node_898;
+		goto structured;
+	node_954:
+		if(*(cache_2+-2) > cb)
+			goto node_953;
+		goto structured;
+	node_953:
+		if(*(cache_2+-1) > cb)
+			goto node_115;
+		goto structured;
+	node_115:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_114;
+		goto structured;
+	node_959:
+		if(*(cache_2+-1) > cb)
+			goto node_958;
+		goto structured;
+	node_958:
+		if(*(cache_0+-3) > cb)
+			goto node_957;
+		goto structured;
+	node_957:
+		if(*(cache_2+-3) > cb)
+			goto node_956;
+		goto structured;
+	node_956:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_898;
+		goto structured;
+	node_966:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_965;
+		goto structured;
+	node_965:
+		if(*(cache_2+-3) > cb)
+			goto node_964;
+		goto structured;
+	node_964:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_963;
+		goto structured;
+	node_963:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_962;
+		goto structured;
+	node_962:
+		if(*(cache_2+-2) > cb)
+			goto node_961;
+		goto structured;
+	node_961:
+		if(*(cache_2+-1) > cb)
+			goto node_8;
+		goto structured;
+	node_992:
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) > cb)
+			goto node_978;
+		if(*(cache_2+-3) < c_b)
+			goto node_987;
+		goto node_344;
+	node_978:
+		if(*(cache_1+2) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+	node_811:
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+	node_810:
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+		goto node_296;
+	node_987:
+		if(*(cache_0+3) > cb)
+			goto node_980;
+		if(*(cache_0+3) < c_b)
+			goto node_986;
+	node_347:
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+	node_346:
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+	node_318:
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		goto node_216;
+	node_980:
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+	node_417:
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		goto node_350;
+	node_986:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_981;
+		if(*(cache_0 + pixel[13]) < c_b)
+			goto node_983;
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+	node_328:
+		if(*(cache_1+2) >= c_b)
+			goto node_216;
+		goto success;
+	node_981:
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+	node_523:
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+		goto node_328;
+	node_983:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_982;
+		if(*(cache_0 + pixel[14]) < c_b)
+			goto node_683;
+		goto node_205;
+	node_870:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_752;
+		if(*(cache_0 + pixel[11]) < c_b)
+			goto node_827;
+		if(*(cache_0+3) > cb)
+			goto node_853;
+		if(*(cache_0+3) < c_b)
+			goto node_868;
+		goto structured;
+	node_853:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_852;
+		goto structured;
+	node_852:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_851;
+		goto structured;
+	node_851:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_844;
+		if(*(cache_0 + pixel[4]) < c_b)
+			goto node_845;
+		if(*(cache_2+-2) > cb)
+			goto node_849;
+		goto structured;
+	node_849:
+		if(*(cache_0+-3) > cb)
+			goto node_848;
+		goto structured;
+	node_848:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_847;
+		goto structured;
+	node_847:
+		if(*cache_2 > cb)
+			goto node_846;
+		goto structured;
+	node_846:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_756;
+		goto structured;
+	node_756:
+		if(*(cache_2+-3) > cb)
+			goto node_3;
+		goto structured;
+	node_844:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_838;
+		if(*(cache_0 + pixel[5]) < c_b)
+			goto node_843;
+	node_787:
+		if(*cache_2 > cb)
+			goto node_76;
+		goto structured;
+	node_838:
+		if(*(cache_1+2) > cb)
+			goto node_831;
+		if(*(cache_1+2) < c_b)
+			goto node_834;
+		if(*(cache_2+-3) > cb)
+			goto node_836;
+		goto structured;
+	node_836:
+		if(*cache_2 > cb)
+			goto node_835;
+		goto structured;
+	node_835:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_5;
+		goto structured;
+	node_831:
+		if(*(cache_1+1) > cb)
+			goto success;
+		if(*(cache_1+1) < c_b)
+			goto node_758;
+		if(*(cache_2+-3) > cb)
+			goto node_829;
+		goto structured;
+	node_829:
+		if(*cache_2 > cb)
+			goto node_828;
+		goto structured;
+	node_758:
+		if(*cache_2 > cb)
+			goto node_757;
+		goto structured;
+	node_757:
+		if(*(cache_2+-2) > cb)
+			goto node_756;
+		goto structured;
+	node_834:
+		if(*(cache_2+-3) > cb)
+			goto node_833;
+		goto structured;
+	node_833:
+		if(*cache_2 > cb)
+			goto node_832;
+		goto structured;
+	node_832:
+		if(*(cache_2+-1) > cb)
+			goto node_477;
+		goto structured;
+	node_843:
+		if(*cache_2 > cb)
+			goto node_842;
+		goto structured;
+	node_842:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_841;
+		goto structured;
+	node_841:
+		if(*(cache_0+-3) > cb)
+			goto node_840;
+		goto node_60;
+	node_840:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_839;
+		goto structured;
+	node_839:
+		if(*(cache_2+-1) > cb)
+			goto node_87;
+		goto structured;
+	node_845:
+		if(*cache_2 > cb)
+			goto node_263;
+		goto structured;
+	node_868:
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_859;
+		if(*(cache_0 + pixel[4]) < c_b)
+			goto node_862;
+	node_341:
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+	node_213:
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+	node_212:
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+	node_178:
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		goto success;
+	node_859:
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto node_341;
+		if(*(cache_1+1) > cb)
+			goto node_857;
+		goto node_341;
+	node_857:
+		if(*(cache_1+2) >= c_b)
+			goto node_341;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		goto node_216;
+	node_862:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_820;
+		if(*(cache_0 + pixel[5]) < c_b)
+			goto node_861;
+		goto node_213;
+	node_820:
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		goto node_819;
+	node_861:
+		if(*(cache_1+2) > cb)
+			goto node_212;
+		if(*(cache_1+2) < c_b)
+			goto node_283;
+	node_860:
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		goto node_216;
+	node_283:
+		if(*(cache_1+1) >= c_b)
+			goto node_178;
+		goto success;
+	node_752:
+		if(*(cache_1+1) > cb)
+			goto node_639;
+		if(*(cache_1+1) < c_b)
+			goto node_701;
+		if(*(cache_2+-3) > cb)
+			goto node_738;
+		if(*(cache_2+-3) < c_b)
+			goto node_750;
+		goto structured;
+	node_738:
+		if(*(cache_2+-2) > cb)
+			goto node_737;
+		goto structured;
+	node_737:
+		if(*(cache_2+-1) > cb)
+			goto node_736;
+		goto structured;
+	node_736:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_724;
+		if(*(cache_0 + pixel[14]) < c_b)
+			goto node_734;
+		if(*cache_2 > cb)
+			goto node_449;
+		goto structured;
+	node_449:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_448;
+		goto structured;
+	node_448:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_91;
+		goto structured;
+	node_91:
+		if(*(cache_0+3) > cb)
+			goto node_90;
+		goto structured;
+	node_90:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_69;
+		goto structured;
+	node_69:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_68;
+		goto structured;
+	node_724:
+		if(*(cache_0+-3) > cb)
+			goto node_709;
+		if(*(cache_0+-3) < c_b)
+			goto node_721;
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_642;
+		if(*(cache_0 + pixel[13]) < c_b)
+			goto node_722;
+	node_708:
+		if(*cache_2 > cb)
+			goto node_707;
+		goto structured;
+	node_707:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_445;
+		goto structured;
+	node_445:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_256;
+		goto structured;
+	node_256:
+		if(*(cache_0+3) > cb)
+			goto node_85;
+		goto structured;
+	node_85:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_84;
+		goto structured;
+	node_84:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto success;
+		goto structured;
+	node_642:
+		if(*cache_2 > cb)
+			goto node_641;
+		goto structured;
+	node_641:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_640;
+		goto structured;
+	node_640:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_253;
+		goto structured;
+	node_722:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_642;
+		goto structured;
+	node_709:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto success;
+		if(*(cache_0 + pixel[13]) < c_b)
+			goto node_706;
+		goto node_708;
+	node_706:
+		if(*cache_2 > cb)
+			goto node_705;
+		goto structured;
+	node_705:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_704;
+		goto structured;
+	node_704:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_703;
+		goto structured;
+	node_703:
+		if(*(cache_0+3) > cb)
+			goto node_702;
+		goto structured;
+	node_702:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_84;
+		goto structured;
+	node_721:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_642;
+		if(*(cache_0 + pixel[5]) < c_b)
+			goto node_715;
+		if(*cache_2 > cb)
+			goto node_719;
+		goto structured;
+	node_719:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_718;
+		goto structured;
+	node_718:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_717;
+		goto structured;
+	node_717:
+		if(*(cache_0+3) > cb)
+			goto node_716;
+		goto structured;
+	node_716:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_103;
+		goto structured;
+	node_715:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_714;
+		goto structured;
+	node_714:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_713;
+		goto structured;
+	node_713:
+		if(*(cache_1+2) > cb)
+			goto node_711;
+		if(*cache_2 > cb)
+			goto node_640;
+		goto structured;
+	node_711:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_710;
+		goto structured;
+	node_710:
+		if(*cache_2 > cb)
+			goto node_253;
+		goto structured;
+	node_734:
+		if(*(cache_0+3) > cb)
+			goto node_733;
+		goto structured;
+	node_733:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_732;
+		goto structured;
+	node_732:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_731;
+		goto structured;
+	node_731:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_730;
+		goto structured;
+	node_730:
+		if(*(cache_0+-3) > cb)
+			goto node_727;
+		if(*cache_2 > cb)
+			goto node_728;
+		goto structured;
+	node_728:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_68;
+		goto structured;
+	node_727:
+		if(*cache_2 > cb)
+			goto node_726;
+		goto structured;
+	node_726:
+		if(*(cache_1+2) > cb)
+			goto node_725;
+		goto structured;
+	node_725:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto success;
+		goto structured;
+	node_750:
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_739;
+		if(*(cache_0 + pixel[14]) < c_b)
+			goto node_741;
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+		goto node_172;
+	node_739:
+		if(*(cache_1+2) >= c_b)
+			goto structured;
+		goto node_210;
+	node_639:
+		if(*(cache_0+-3) > cb)
+			goto node_558;
+		if(*(cache_0+-3) < c_b)
+			goto node_614;
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_630;
+		if(*(cache_0 + pixel[2]) < c_b)
+			goto node_637;
+		goto structured;
+	node_630:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_629;
+		goto structured;
+	node_629:
+		if(*(cache_0+3) > cb)
+			goto node_628;
+		goto structured;
+	node_628:
+		if(*(cache_1+2) > cb)
+			goto node_620;
+		if(*(cache_1+2) < c_b)
+			goto node_627;
+	node_577:
+		if(*cache_2 > cb)
+			goto node_576;
+		goto structured;
+	node_576:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_575;
+		goto structured;
+	node_575:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_574;
+		goto structured;
+	node_574:
+		if(*(cache_2+-3) > cb)
+			goto node_573;
+		goto structured;
+	node_573:
+		if(*(cache_2+-2) > cb)
+			goto node_572;
+		goto structured;
+	node_572:
+		if(*(cache_2+-1) > cb)
+			goto node_122;
+		goto structured;
+	node_620:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto success;
+		if(*(cache_0 + pixel[5]) < c_b)
+			goto node_619;
+	node_565:
+		if(*cache_2 > cb)
+			goto node_564;
+		goto structured;
+	node_564:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_76;
+		goto structured;
+	node_619:
+		if(*(cache_2+-1) > cb)
+			goto node_618;
+		goto structured;
+	node_618:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_617;
+		goto structured;
+	node_617:
+		if(*cache_2 > cb)
+			goto node_616;
+		goto structured;
+	node_616:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_615;
+		goto structured;
+	node_627:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_622;
+		if(*(cache_0 + pixel[5]) < c_b)
+			goto node_626;
+		goto node_565;
+	node_622:
+		if(*cache_2 > cb)
+			goto node_621;
+		goto structured;
+	node_621:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_60;
+		goto structured;
+	node_626:
+		if(*cache_2 > cb)
+			goto node_625;
+		goto structured;
+	node_625:
+		if(*(cache_2+-3) > cb)
+			goto node_624;
+		goto structured;
+	node_624:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_623;
+		goto structured;
+	node_623:
+		if(*(cache_2+-1) > cb)
+			goto node_559;
+		goto structured;
+	node_637:
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+	node_321:
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto node_173;
+	node_320:
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto node_319;
+		goto success;
+	node_558:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_495;
+		if(*(cache_0 + pixel[13]) < c_b)
+			goto node_540;
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_547;
+		if(*(cache_0 + pixel[4]) < c_b)
+			goto node_556;
+		goto structured;
+	node_547:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_546;
+		goto structured;
+	node_546:
+		if(*(cache_1+2) > cb)
+			goto node_541;
+		if(*cache_2 > cb)
+			goto node_544;
+		goto structured;
+	node_544:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_543;
+		goto structured;
+	node_543:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_542;
+		goto structured;
+	node_542:
+		if(*(cache_0+3) > cb)
+			goto node_60;
+		goto structured;
+	node_556:
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+		if(*(cache_1+2) >= c_b)
+			goto node_548;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+	node_549:
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+	node_175:
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		goto success;
+	node_548:
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+	node_177:
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+	node_176:
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		goto node_175;
+	node_495:
+		if(*(cache_1+2) > cb)
+			goto node_476;
+		if(*(cache_1+2) < c_b)
+			goto node_485;
+		if(*(cache_2+-2) > cb)
+			goto node_114;
+		if(*(cache_2+-2) < c_b)
+			goto node_493;
+		goto structured;
+	node_493:
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		goto node_152;
+	node_476:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_251;
+		if(*(cache_0 + pixel[5]) < c_b)
+			goto node_474;
+	node_475:
+		if(*(cache_2+-3) > cb)
+			goto node_108;
+		goto structured;
+	node_251:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto success;
+		goto node_108;
+	node_474:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_82;
+		if(*(cache_0 + pixel[14]) < c_b)
+			goto node_473;
+		goto structured;
+	node_473:
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		goto node_214;
+	node_485:
+		if(*(cache_2+-3) > cb)
+			goto node_477;
+		if(*(cache_2+-3) < c_b)
+			goto node_484;
+		goto structured;
+	node_484:
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+	node_143:
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		goto success;
+	node_540:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_522;
+		if(*(cache_0 + pixel[5]) < c_b)
+			goto node_530;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+	node_532:
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+	node_531:
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		goto success;
+	node_522:
+		if(*(cache_0+3) > cb)
+			goto node_510;
+		if(*(cache_0+3) < c_b)
+			goto node_521;
+		goto structured;
+	node_510:
+		if(*(cache_1+2) > cb)
+			goto node_252;
+		if(*(cache_1+2) < c_b)
+			goto node_502;
+		if(*(cache_2+-1) > cb)
+			goto node_508;
+		goto structured;
+	node_508:
+		if(*(cache_2+-2) > cb)
+			goto node_507;
+		goto structured;
+	node_507:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_506;
+		goto structured;
+	node_506:
+		if(*(cache_2+-3) > cb)
+			goto node_505;
+		goto structured;
+	node_505:
+		if(*cache_2 > cb)
+			goto node_504;
+		goto structured;
+	node_504:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_503;
+		goto structured;
+	node_503:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_252;
+		goto structured;
+	node_502:
+		if(*(cache_2+-2) > cb)
+			goto node_501;
+		goto structured;
+	node_501:
+		if(*(cache_2+-1) > cb)
+			goto node_500;
+		goto structured;
+	node_500:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_499;
+		goto structured;
+	node_499:
+		if(*cache_2 > cb)
+			goto node_498;
+		goto structured;
+	node_498:
+		if(*(cache_2+-3) > cb)
+			goto node_497;
+		goto structured;
+	node_497:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_496;
+		goto structured;
+	node_496:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_108;
+		goto structured;
+	node_521:
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_1+2) > cb)
+			goto node_515;
+	node_518:
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+	node_151:
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+	node_150:
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		goto node_143;
+	node_515:
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+	node_511:
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		goto node_143;
+	node_530:
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		goto node_523;
+	node_614:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_586;
+		if(*(cache_0 + pixel[4]) < c_b)
+			goto node_602;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_1+2) > cb)
+			goto node_604;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		goto node_175;
+	node_604:
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+	node_603:
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		goto success;
+	node_586:
+		if(*(cache_0+3) > cb)
+			goto node_579;
+		if(*(cache_0+3) < c_b)
+			goto node_585;
+		goto structured;
+	node_579:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_578;
+		goto structured;
+	node_578:
+		if(*(cache_1+2) > cb)
+			goto node_566;
+		if(*(cache_1+2) < c_b)
+			goto node_571;
+		goto node_577;
+	node_566:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto success;
+		if(*(cache_0 + pixel[5]) < c_b)
+			goto node_563;
+		goto node_565;
+	node_563:
+		if(*(cache_2+-1) > cb)
+			goto node_562;
+		goto structured;
+	node_562:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_561;
+		goto structured;
+	node_561:
+		if(*(cache_2+-3) > cb)
+			goto node_560;
+		goto structured;
+	node_560:
+		if(*cache_2 > cb)
+			goto node_559;
+		goto structured;
+	node_571:
+		if(*cache_2 > cb)
+			goto node_570;
+		goto structured;
+	node_570:
+		if(*(cache_2+-1) > cb)
+			goto node_569;
+		goto structured;
+	node_569:
+		if(*(cache_2+-3) > cb)
+			goto node_568;
+		goto structured;
+	node_568:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_567;
+		goto structured;
+	node_567:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_477;
+		goto node_559;
+	node_585:
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+	node_580:
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+	node_295:
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		goto node_178;
+	node_602:
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_590;
+		if(*(cache_0 + pixel[13]) < c_b)
+			goto node_592;
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_594;
+		if(*(cache_0 + pixel[14]) < c_b)
+			goto node_589;
+	node_588:
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+		if(*(cache_1+2) >= c_b)
+			goto structured;
+		goto node_178;
+	node_594:
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		goto node_172;
+	node_589:
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+		goto node_178;
+	node_590:
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto node_588;
+		goto node_589;
+	node_592:
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto node_591;
+		goto node_178;
+	node_591:
+		if(*(cache_1+2) >= c_b)
+			goto structured;
+		goto node_589;
+	node_701:
+		if(*(cache_2+-3) > cb)
+			goto node_682;
+		if(*(cache_2+-3) < c_b)
+			goto node_693;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_1+2) >= c_b)
+			goto structured;
+		goto node_150;
+	node_682:
+		if(*(cache_2+-2) > cb)
+			goto node_673;
+		if(*(cache_2+-2) < c_b)
+			goto node_681;
+		goto structured;
+	node_673:
+		if(*(cache_2+-1) > cb)
+			goto node_672;
+		goto structured;
+	node_672:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_657;
+		if(*(cache_0 + pixel[13]) < c_b)
+			goto node_663;
+		if(*cache_2 > cb)
+			goto node_670;
+		goto structured;
+	node_670:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_669;
+		goto structured;
+	node_669:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_668;
+		goto structured;
+	node_668:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_667;
+		goto structured;
+	node_667:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_664;
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_665;
+		goto structured;
+	node_664:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_541;
+		goto structured;
+	node_657:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_643;
+		if(*(cache_0 + pixel[14]) < c_b)
+			goto node_650;
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_655;
+		goto structured;
+	node_655:
+		if(*cache_2 > cb)
+			goto node_654;
+		goto structured;
+	node_654:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_653;
+		goto structured;
+	node_653:
+		if(*(cache_0+3) > cb)
+			goto node_652;
+		goto structured;
+	node_652:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_651;
+		goto structured;
+	node_651:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_68;
+		goto structured;
+	node_643:
+		if(*(cache_0+-3) > cb)
+			goto success;
+		goto node_642;
+	node_650:
+		if(*(cache_0+3) > cb)
+			goto node_649;
+		goto structured;
+	node_649:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_648;
+		goto structured;
+	node_648:
+		if(*(cache_1+2) > cb)
+			goto node_647;
+		goto structured;
+	node_647:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_646;
+		goto structured;
+	node_646:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_645;
+		goto structured;
+	node_645:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_644;
+		goto structured;
+	node_644:
+		if(*cache_2 > cb)
+			goto success;
+		goto structured;
+	node_663:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_662;
+		goto structured;
+	node_662:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_661;
+		goto structured;
+	node_661:
+		if(*cache_2 > cb)
+			goto node_660;
+		goto structured;
+	node_660:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_659;
+		goto structured;
+	node_659:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_658;
+		goto structured;
+	node_658:
+		if(*(cache_0+3) > cb)
+			goto node_194;
+		goto structured;
+	node_194:
+		if(*(cache_1+2) > cb)
+			goto success;
+		goto node_108;
+	node_681:
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_1+2) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+		goto node_674;
+	node_693:
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_205;
+		if(*(cache_0 + pixel[14]) < c_b)
+			goto node_684;
+		goto node_686;
+	node_684:
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto node_210;
+		goto node_683;
+	node_827:
+		if(*(cache_0+3) > cb)
+			goto node_804;
+		if(*(cache_0+3) < c_b)
+			goto node_818;
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		goto node_820;
+	node_804:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_796;
+		if(*(cache_0 + pixel[2]) < c_b)
+			goto node_803;
+		goto structured;
+	node_796:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_795;
+		goto structured;
+	node_795:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_782;
+		if(*(cache_0 + pixel[4]) < c_b)
+			goto node_786;
+		if(*(cache_0+-3) > cb)
+			goto node_793;
+		goto structured;
+	node_793:
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto node_787;
+		if(*(cache_2+-1) > cb)
+			goto node_791;
+		goto structured;
+	node_791:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_790;
+		goto structured;
+	node_790:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_789;
+		goto structured;
+	node_789:
+		if(*(cache_2+-2) > cb)
+			goto node_788;
+		goto structured;
+	node_788:
+		if(*cache_2 > cb)
+			goto node_82;
+		goto structured;
+	node_782:
+		if(*(cache_1+2) > cb)
+			goto node_770;
+		if(*(cache_1+2) < c_b)
+			goto node_776;
+		if(*(cache_2+-2) > cb)
+			goto node_780;
+		goto structured;
+	node_780:
+		if(*cache_2 > cb)
+			goto node_779;
+		goto structured;
+	node_779:
+		if(*(cache_2+-3) > cb)
+			goto node_778;
+		goto structured;
+	node_778:
+		if(*(cache_2+-1) > cb)
+			goto node_777;
+		goto structured;
+	node_777:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_771;
+		goto structured;
+	node_771:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto success;
+		goto node_84;
+	node_770:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_759;
+		if(*(cache_0 + pixel[5]) < c_b)
+			goto node_764;
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_768;
+		goto structured;
+	node_768:
+		if(*(cache_2+-2) > cb)
+			goto node_767;
+		goto structured;
+	node_767:
+		if(*(cache_2+-1) > cb)
+			goto node_766;
+		goto structured;
+	node_766:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_765;
+		goto structured;
+	node_765:
+		if(*(cache_2+-3) > cb)
+			goto node_644;
+		goto structured;
+	node_759:
+		if(*(cache_1+1) > cb)
+			goto success;
+		if(*(cache_1+1) < c_b)
+			goto node_755;
+		goto node_758;
+	node_755:
+		if(*(cache_2+-2) > cb)
+			goto node_754;
+		goto structured;
+	node_754:
+		if(*(cache_2+-3) > cb)
+			goto node_753;
+		goto structured;
+	node_753:
+		if(*cache_2 > cb)
+			goto node_3;
+		goto structured;
+	node_764:
+		if(*(cache_2+-3) > cb)
+			goto node_763;
+		goto structured;
+	node_763:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_762;
+		goto structured;
+	node_762:
+		if(*cache_2 > cb)
+			goto node_761;
+		goto structured;
+	node_761:
+		if(*(cache_2+-1) > cb)
+			goto node_760;
+		goto structured;
+	node_760:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_66;
+		goto structured;
+	node_776:
+		if(*(cache_2+-1) > cb)
+			goto node_775;
+		goto structured;
+	node_775:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_774;
+		goto structured;
+	node_774:
+		if(*cache_2 > cb)
+			goto node_773;
+		goto structured;
+	node_773:
+		if(*(cache_2+-3) > cb)
+			goto node_772;
+		goto structured;
+	node_772:
+		if(*(cache_2+-2) > cb)
+			goto node_771;
+		goto structured;
+	node_786:
+		if(*cache_2 > cb)
+			goto node_785;
+		goto structured;
+	node_785:
+		if(*(cache_2+-2) > cb)
+			goto node_784;
+		goto structured;
+	node_784:
+		if(*(cache_2+-1) > cb)
+			goto node_783;
+		goto structured;
+	node_783:
+		if(*(cache_2+-3) > cb)
+			goto node_110;
+		goto structured;
+	node_110:
+		if(*(cache_0+-3) > cb)
+			goto node_109;
+		goto structured;
+	node_109:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_108;
+		goto structured;
+	node_803:
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		goto node_216;
+	node_818:
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) > cb)
+			goto node_806;
+		if(*(cache_2+-3) < c_b)
+			goto node_809;
+		if(*(cache_1+2) >= c_b)
+			goto structured;
+		goto node_811;
+	node_806:
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+		if(*(cache_1+1) >= c_b)
+			goto structured;
+		goto node_173;
+	node_809:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_739;
+		if(*(cache_0 + pixel[14]) < c_b)
+			goto node_808;
+		goto node_686;
+	node_808:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_348;
+		if(*(cache_0 + pixel[4]) < c_b)
+			goto node_320;
+		goto node_807;
+	node_945:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_919;
+		if(*(cache_0 + pixel[2]) < c_b)
+			goto node_936;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		goto node_178;
+	node_919:
+		if(*cache_2 > cb)
+			goto node_911;
+		if(*cache_2 < c_b)
+			goto node_918;
+		goto structured;
+	node_911:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_910;
+		goto structured;
+	node_910:
+		if(*(cache_0+3) > cb)
+			goto node_897;
+		if(*(cache_0+3) < c_b)
+			goto node_903;
+		if(*(cache_2+-1) > cb)
+			goto node_908;
+		goto structured;
+	node_908:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_907;
+		goto structured;
+	node_907:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_906;
+		goto structured;
+	node_906:
+		if(*(cache_2+-2) > cb)
+			goto node_905;
+		goto structured;
+	node_905:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_904;
+		goto structured;
+	node_904:
+		if(*(cache_2+-3) > cb)
+			goto node_8;
+		goto structured;
+	node_897:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_887;
+		if(*(cache_0 + pixel[4]) < c_b)
+			goto node_891;
+		if(*(cache_2+-2) > cb)
+			goto node_895;
+		goto structured;
+	node_895:
+		if(*(cache_2+-3) > cb)
+			goto node_894;
+		goto structured;
+	node_894:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_893;
+		goto structured;
+	node_893:
+		if(*(cache_0+-3) > cb)
+			goto node_892;
+		goto structured;
+	node_892:
+		if(*(cache_2+-1) > cb)
+			goto node_108;
+		goto structured;
+	node_887:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_877;
+		if(*(cache_0 + pixel[5]) < c_b)
+			goto node_881;
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_885;
+		goto structured;
+	node_885:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_883;
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_6;
+		goto structured;
+	node_883:
+		if(*(cache_2+-3) > cb)
+			goto node_882;
+		goto structured;
+	node_882:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_5;
+		goto structured;
+	node_877:
+		if(*(cache_1+2) > cb)
+			goto node_871;
+		if(*(cache_1+2) < c_b)
+			goto node_873;
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_875;
+		goto structured;
+	node_875:
+		if(*(cache_2+-1) > cb)
+			goto node_874;
+		goto structured;
+	node_871:
+		if(*(cache_1+1) > cb)
+			goto success;
+		goto node_757;
+	node_873:
+		if(*(cache_2+-1) > cb)
+			goto node_872;
+		goto structured;
+	node_872:
+		if(*(cache_2+-2) > cb)
+			goto node_475;
+		goto structured;
+	node_881:
+		if(*(cache_2+-3) > cb)
+			goto node_880;
+		goto structured;
+	node_880:
+		if(*(cache_2+-2) > cb)
+			goto node_879;
+		goto structured;
+	node_879:
+		if(*(cache_2+-1) > cb)
+			goto node_878;
+		goto structured;
+	node_878:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_103;
+		goto structured;
+	node_891:
+		if(*(cache_2+-3) > cb)
+			goto node_890;
+		goto structured;
+	node_890:
+		if(*(cache_0+-3) > cb)
+			goto node_889;
+		goto structured;
+	node_889:
+		if(*(cache_2+-1) > cb)
+			goto node_888;
+		goto structured;
+	node_888:
+		if(*(cache_2+-2) > cb)
+			goto node_878;
+		goto structured;
+	node_903:
+		if(*(cache_0+-3) > cb)
+			goto node_902;
+		goto structured;
+	node_902:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_901;
+		goto structured;
+	node_901:
+		if(*(cache_2+-1) > cb)
+			goto node_900;
+		goto structured;
+	node_900:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_899;
+		goto structured;
+	node_899:
+		if(*(cache_2+-3) > cb)
+			goto node_898;
+		goto structured;
+	node_918:
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+	node_912:
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		goto node_175;
+	node_936:
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0+3) > cb)
+			goto node_921;
+		if(*(cache_0+3) < c_b)
+			goto node_928;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		goto node_318;
+	node_921:
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		goto node_820;
+	node_928:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_923;
+		if(*(cache_0 + pixel[4]) < c_b)
+			goto node_926;
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+	node_925:
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		goto node_318;
+	node_923:
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		goto node_860;
+	node_926:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_820;
+		if(*(cache_0 + pixel[5]) < c_b)
+			goto node_924;
+		goto node_925;
+	node_924:
+		if(*(cache_1+2) > cb)
+			goto node_860;
+		if(*(cache_1+2) < c_b)
+			goto node_283;
+		goto node_212;
+	node_1073:
+		if(*cache_2 > cb)
+			goto node_1027;
+		if(*cache_2 < c_b)
+			goto node_1072;
+		goto structured;
+	node_1027:
+		if(*(cache_2+-1) > cb)
+			goto node_1026;
+		goto structured;
+	node_1026:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1025;
+		goto structured;
+	node_1025:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1014;
+		if(*(cache_0 + pixel[2]) < c_b)
+			goto node_1018;
+		if(*(cache_0 + pixel[10]) > cb)
+			goto node_1023;
+		goto structured;
+	node_1023:
+		if(*(cache_2+-2) > cb)
+			goto node_1022;
+		goto structured;
+	node_1022:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_1021;
+		goto structured;
+	node_1021:
+		if(*(cache_0+-3) > cb)
+			goto node_1020;
+		goto structured;
+	node_1020:
+		if(*(cache_2+-3) > cb)
+			goto node_1019;
+		goto structured;
+	node_1019:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_24;
+		goto structured;
+	node_1014:
+		if(*(cache_0+3) > cb)
+			goto node_1005;
+		if(*(cache_0+3) < c_b)
+			goto node_1009;
+		if(*(cache_2+-3) > cb)
+			goto node_1012;
+		goto structured;
+	node_1012:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_1011;
+		goto structured;
+	node_1011:
+		if(*(cache_0+-3) > cb)
+			goto node_1010;
+		goto structured;
+	node_1010:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_477;
+		goto structured;
+	node_1005:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_999;
+		if(*(cache_0 + pixel[4]) < c_b)
+			goto node_1001;
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_1003;
+		goto structured;
+	node_1003:
+		if(*(cache_0+-3) > cb)
+			goto node_1002;
+		goto structured;
+	node_1002:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_874;
+		goto structured;
+	node_999:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_996;
+		if(*(cache_0 + pixel[5]) < c_b)
+			goto node_998;
+		goto node_900;
+	node_996:
+		if(*(cache_1+2) > cb)
+			goto node_995;
+		if(*(cache_1+2) < c_b)
+			goto node_950;
+		goto node_899;
+	node_995:
+		if(*(cache_1+1) > cb)
+			goto success;
+		if(*(cache_1+1) < c_b)
+			goto node_87;
+		goto node_874;
+	node_998:
+		if(*(cache_2+-2) > cb)
+			goto node_997;
+		goto structured;
+	node_997:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_132;
+		goto structured;
+	node_1001:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_1000;
+		goto structured;
+	node_1000:
+		if(*(cache_0+-3) > cb)
+			goto node_615;
+		goto structured;
+	node_1009:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_1008;
+		goto structured;
+	node_1008:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_1007;
+		goto structured;
+	node_1007:
+		if(*(cache_2+-3) > cb)
+			goto node_1006;
+		goto structured;
+	node_1006:
+		if(*(cache_0+-3) > cb)
+			goto node_898;
+		goto structured;
+	node_1018:
+		if(*(cache_0 + pixel[10]) > cb)
+			goto node_1017;
+		goto structured;
+	node_1017:
+		if(*(cache_0+-3) > cb)
+			goto node_1016;
+		goto structured;
+	node_1016:
+		if(*(cache_2+-3) > cb)
+			goto node_1015;
+		goto structured;
+	node_1015:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_956;
+		goto structured;
+	node_1072:
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) > cb)
+			goto node_1033;
+		if(*(cache_2+-3) < c_b)
+			goto node_1063;
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		if(*(cache_1+2) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_1+1) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+		goto node_603;
+	node_1033:
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_1+1) >= c_b)
+			goto structured;
+	node_1028:
+		if(*(cache_1+2) >= c_b)
+			goto structured;
+		goto node_214;
+	node_1063:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_1037;
+		if(*(cache_0 + pixel[14]) < c_b)
+			goto node_1057;
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		goto node_172;
+	node_1037:
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		goto node_1028;
+	node_1057:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_1041;
+		if(*(cache_0 + pixel[13]) < c_b)
+			goto node_1054;
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+	node_1046:
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		goto node_674;
+	node_1041:
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		goto node_1039;
+	node_1054:
+		if(*(cache_0+-3) > cb)
+			goto node_1044;
+		if(*(cache_0+-3) < c_b)
+			goto node_1050;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		goto node_1051;
+	node_1044:
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+		goto node_674;
+	node_1050:
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto node_1046;
+		if(*(cache_0 + pixel[10]) > cb)
+			goto node_1047;
+		if(*(cache_0 + pixel[10]) < c_b)
+			goto success;
+	node_1048:
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		goto node_603;
+	node_1047:
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		goto node_531;
+	node_1939:
+		if(*(cache_1+-1) > cb)
+			goto node_1237;
+		if(*(cache_1+-1) < c_b)
+			goto node_1866;
+		if(*cache_2 > cb)
+			goto node_1895;
+		if(*cache_2 < c_b)
+			goto node_1937;
+		goto homogeneous;
+	node_1895:
+		if(*(cache_2+-1) > cb)
+			goto node_1894;
+		if(*(cache_2+-1) < c_b)
+			goto structured;
+		goto homogeneous;
+	node_1894:
+		if(*(cache_2+-2) > cb)
+			goto node_1893;
+		goto structured;
+	node_1893:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1892;
+		goto structured;
+	node_1892:
+		if(*(cache_2+-3) > cb)
+			goto node_1882;
+		if(*(cache_2+-3) < c_b)
+			goto node_1887;
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1890;
+		goto structured;
+	node_1890:
+		if(*(cache_1+2) > cb)
+			goto node_1889;
+		goto structured;
+	node_1889:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1888;
+		goto structured;
+	node_1888:
+		if(*(cache_0+3) > cb)
+			goto node_1390;
+		goto structured;
+	node_1882:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_1875;
+		if(*(cache_0 + pixel[14]) < c_b)
+			goto node_1878;
+		if(*(cache_1+2) > cb)
+			goto node_1880;
+		goto structured;
+	node_1880:
+		if(*(cache_0+3) > cb)
+			goto node_1879;
+		goto structured;
+	node_1879:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_85;
+		goto structured;
+	node_1875:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_1872;
+		if(*(cache_0 + pixel[13]) < c_b)
+			goto node_1874;
+		goto node_445;
+	node_1872:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1868;
+		if(*(cache_0 + pixel[2]) < c_b)
+			goto node_1869;
+		if(*(cache_1+2) > cb)
+			goto node_1870;
+	node_10:
+		if(*(cache_0 + pixel[10]) > cb)
+			goto node_9;
+		goto structured;
+	node_9:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_8;
+		goto structured;
+	node_1870:
+		if(*(cache_0 + pixel[10]) > cb)
+			goto node_1867;
+		goto structured;
+	node_1868:
+		if(*(cache_0+3) > cb)
+			goto node_101;
+		if(*(cache_0+3) < c_b)
+			goto node_9;
+		goto node_1867;
+	node_101:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto success;
+		goto node_8;
+	node_1869:
+		if(*(cache_0+-3) > cb)
+			goto node_25;
+		goto structured;
+	node_25:
+		if(*(cache_0 + pixel[10]) > cb)
+			goto node_24;
+		goto structured;
+	node_1874:
+		if(*(cache_0+3) > cb)
+			goto node_1873;
+		goto structured;
+	node_1873:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1239;
+		goto structured;
+	node_1239:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_252;
+		goto structured;
+	node_1878:
+		if(*(cache_1+2) > cb)
+			goto node_1877;
+		goto structured;
+	node_1877:
+		if(*(cache_0+3) > cb)
+			goto node_1876;
+		goto structured;
+	node_1876:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_1190;
+		goto structured;
+	node_1190:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_252;
+		goto structured;
+	node_1887:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_1886;
+		goto structured;
+	node_1886:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1885;
+		goto structured;
+	node_1885:
+		if(*(cache_1+1) > cb)
+			goto node_1884;
+		goto structured;
+	node_1884:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1883;
+		goto structured;
+	node_1937:
+		if(*(cache_2+-1) > cb)
+			goto structured;
+		if(*(cache_2+-1) < c_b)
+			goto node_1936;
+		goto homogeneous;
+	node_1936:
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1901;
+		if(*(cache_0 + pixel[2]) < c_b)
+			goto node_1927;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto node_1928;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[10]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+	node_1215:
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		goto node_178;
+	node_1928:
+		if(*(cache_0 + pixel[10]) >= c_b)
+			goto structured;
+	node_209:
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+	node_208:
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		goto node_177;
+	node_1901:
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[10]) >= c_b)
+			goto structured;
+		goto node_350;
+	node_1927:
+		if(*(cache_0+3) > cb)
+			goto node_1905;
+		if(*(cache_0+3) < c_b)
+			goto node_1921;
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		goto node_175;
+	node_1905:
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+	node_1272:
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		goto node_319;
+	node_1921:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1909;
+		if(*(cache_0 + pixel[4]) < c_b)
+			goto node_1918;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+	node_1205:
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		goto node_295;
+	node_1909:
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		goto node_175;
+	node_1918:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_1910;
+		if(*(cache_0 + pixel[5]) < c_b)
+			goto node_1912;
+		if(*(cache_1+1) > cb)
+			goto node_1916;
+		goto node_208;
+	node_1916:
+		if(*(cache_0 + pixel[10]) > cb)
+			goto node_1915;
+		goto node_208;
+	node_1915:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_1914;
+		goto node_208;
+	node_1914:
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+	node_1217:
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		goto node_175;
+	node_1910:
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+	node_1209:
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		goto node_295;
+	node_1912:
+		if(*(cache_1+2) > cb)
+			goto node_1220;
+		if(*(cache_1+2) < c_b)
+			goto node_1911;
+		goto node_177;
+	node_1220:
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		goto node_1215;
+	node_1911:
+		if(*(cache_1+1) >= c_b)
+			goto node_176;
+		goto success;
+	node_1237:
+		if(*(cache_2+-1) > cb)
+			goto node_1198;
+		if(*(cache_2+-1) < c_b)
+			goto node_1236;
+		goto structured;
+	node_1198:
+		if(*cache_2 > cb)
+			goto node_1197;
+		goto structured;
+	node_1197:
+		if(*(cache_2+-2) > cb)
+			goto node_1196;
+		goto structured;
+	node_1196:
+		if(*(cache_2+-3) > cb)
+			goto node_1183;
+		if(*(cache_2+-3) < c_b)
+			goto node_1189;
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1194;
+		goto structured;
+	node_1194:
+		if(*(cache_0+3) > cb)
+			goto node_1193;
+		goto structured;
+	node_1193:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_1192;
+		goto structured;
+	node_1192:
+		if(*(cache_1+2) > cb)
+			goto node_1191;
+		goto structured;
+	node_1191:
+		if(*(cache_1+1) > cb)
+			goto node_1190;
+		goto structured;
+	node_1183:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_1172;
+		if(*(cache_0 + pixel[14]) < c_b)
+			goto node_1177;
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1181;
+		goto structured;
+	node_1181:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_1180;
+		goto structured;
+	node_1180:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1179;
+		goto structured;
+	node_1179:
+		if(*(cache_0+3) > cb)
+			goto node_1178;
+		goto structured;
+	node_1178:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_68;
+		goto structured;
+	node_1172:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_1166;
+		if(*(cache_0 + pixel[13]) < c_b)
+			goto node_1169;
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_1170;
+		goto structured;
+	node_1170:
+		if(*(cache_0+3) > cb)
+			goto node_504;
+		goto structured;
+	node_1166:
+		if(*(cache_0+-3) > cb)
+			goto node_1159;
+		if(*(cache_0+-3) < c_b)
+			goto node_1162;
+		if(*(cache_0+3) > cb)
+			goto node_1164;
+		goto structured;
+	node_1164:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1163;
+		goto structured;
+	node_1163:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_725;
+		goto structured;
+	node_1159:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_1155;
+		if(*(cache_0 + pixel[11]) < c_b)
+			goto node_1156;
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1157;
+		goto structured;
+	node_1157:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_541;
+		goto structured;
+	node_1155:
+		if(*(cache_0 + pixel[10]) > cb)
+			goto success;
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1153;
+		goto structured;
+	node_1153:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto success;
+		goto structured;
+	node_1156:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_664;
+		goto structured;
+	node_1162:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1161;
+		goto structured;
+	node_1161:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1160;
+		goto structured;
+	node_1160:
+		if(*(cache_0+3) > cb)
+			goto node_1153;
+		goto structured;
+	node_1169:
+		if(*(cache_0+3) > cb)
+			goto node_1168;
+		goto structured;
+	node_1168:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1167;
+		goto structured;
+	node_1167:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_1163;
+		goto structured;
+	node_1177:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1176;
+		goto structured;
+	node_1176:
+		if(*(cache_0+3) > cb)
+			goto node_1175;
+		goto structured;
+	node_1175:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1174;
+		goto structured;
+	node_1174:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1173;
+		goto structured;
+	node_1173:
+		if(*(cache_1+2) > cb)
+			goto node_84;
+		goto structured;
+	node_1189:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1188;
+		goto structured;
+	node_1188:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1187;
+		goto structured;
+	node_1187:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_1186;
+		goto structured;
+	node_1186:
+		if(*(cache_0+3) > cb)
+			goto node_1185;
+		goto structured;
+	node_1185:
+		if(*(cache_1+2) > cb)
+			goto node_1184;
+		goto structured;
+	node_1184:
+		if(*(cache_1+1) > cb)
+			goto node_252;
+		goto structured;
+	node_1236:
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1204;
+		if(*(cache_0 + pixel[2]) < c_b)
+			goto node_1227;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[10]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		goto node_319;
+	node_1204:
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[10]) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		goto node_216;
+	node_1227:
+		if(*(cache_0+3) > cb)
+			goto node_1208;
+		if(*(cache_0+3) < c_b)
+			goto node_1225;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		goto node_921;
+	node_1208:
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		goto node_1205;
+	node_1225:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1211;
+		if(*(cache_0 + pixel[4]) < c_b)
+			goto node_1222;
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		goto node_925;
+	node_1211:
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		goto node_1209;
+	node_1222:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_1213;
+		if(*(cache_0 + pixel[5]) < c_b)
+			goto node_1219;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		goto node_1220;
+	node_1213:
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		goto node_860;
+	node_1219:
+		if(*(cache_1+2) > cb)
+			goto node_1214;
+		if(*(cache_1+2) < c_b)
+			goto node_1216;
+	node_1218:
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		goto node_1217;
+	node_1214:
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		goto node_212;
+	node_1216:
+		if(*(cache_1+1) > cb)
+			goto node_176;
+		if(*(cache_1+1) < c_b)
+			goto success;
+		goto node_1215;
+	node_1866:
+		if(*(cache_0 + pixel[10]) > cb)
+			goto node_1312;
+		if(*(cache_0 + pixel[10]) < c_b)
+			goto node_1821;
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1836;
+		if(*(cache_0 + pixel[1]) < c_b)
+			goto node_1864;
+		goto homogeneous;
+	node_1836:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1835;
+		goto structured;
+	node_1835:
+		if(*(cache_2+-1) > cb)
+			goto node_1834;
+		goto structured;
+	node_1834:
+		if(*(cache_2+-2) > cb)
+			goto node_1833;
+		goto structured;
+	node_1833:
+		if(*cache_2 > cb)
+			goto node_1832;
+		goto structured;
+	node_1832:
+		if(*(cache_0+3) > cb)
+			goto node_1825;
+		if(*(cache_0+3) < c_b)
+			goto node_1829;
+		if(*(cache_0 + pixel[5]) > cb||*(cache_0 + pixel[5]) < c_b)
+			goto node_117;
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_1100;
+		goto structured;
+	node_117:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_116;
+		goto structured;
+	node_116:
+		if(*(cache_0+-3) > cb)
+			goto node_115;
+		goto structured;
+	node_1825:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1823;
+		if(*(cache_0 + pixel[4]) < c_b)
+			goto node_1824;
+		goto node_116;
+	node_1823:
+		if(*(cache_2+-3) > cb)
+			goto node_1822;
+		if(*(cache_2+-3) < c_b)
+			goto node_1391;
+	node_54:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_52;
+		goto structured;
+	node_52:
+		if(*(cache_1+2) > cb)
+			goto node_35;
+		goto structured;
+	node_1822:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_194;
+		goto node_109;
+	node_1824:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_1099;
+		goto structured;
+	node_1829:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_1828;
+		goto structured;
+	node_1828:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_1827;
+		goto structured;
+	node_1827:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_1826;
+		goto structured;
+	node_1826:
+		if(*(cache_0+-3) > cb)
+			goto node_82;
+		goto structured;
+	node_1864:
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0+3) > cb)
+			goto node_1841;
+		if(*(cache_0+3) < c_b)
+			goto node_1854;
+		if(*(cache_0 + pixel[5]) > cb||*(cache_0 + pixel[5]) < c_b)
+			goto node_204;
+		if(*(cache_1+2) > cb)
+			goto node_1859;
+		if(*(cache_1+2) < c_b)
+			goto node_204;
+	node_461:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto structured;
+		if(*(cache_0 + pixel[11]) < c_b)
+			goto node_203;
+		goto homogeneous;
+	node_203:
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+	node_171:
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+	node_170:
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		goto node_151;
+	node_1859:
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+	node_1416:
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		goto node_143;
+	node_204:
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		goto node_203;
+	node_1841:
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		goto node_819;
+	node_1854:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1845;
+		if(*(cache_0 + pixel[4]) < c_b)
+			goto node_1853;
+		goto node_203;
+	node_1845:
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		goto node_860;
+	node_1853:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_1846;
+		if(*(cache_0 + pixel[5]) < c_b)
+			goto node_1852;
+		goto node_171;
+	node_1846:
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+	node_1281:
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+	node_1279:
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		goto node_216;
+	node_1852:
+		if(*(cache_1+2) > cb)
+			goto node_1847;
+		if(*(cache_1+2) < c_b)
+			goto node_1849;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		goto node_1416;
+	node_1847:
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		goto node_1218;
+	node_1849:
+		if(*(cache_1+1) > cb)
+			goto node_1848;
+		if(*(cache_1+1) < c_b)
+			goto success;
+		goto node_151;
+	node_1848:
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		goto node_176;
+	node_1312:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1258;
+		if(*(cache_0 + pixel[2]) < c_b)
+			goto node_1303;
+		if(*(cache_0+-3) > cb)
+			goto node_1310;
+		goto structured;
+	node_1310:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1309;
+		goto structured;
+	node_1309:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_1308;
+		goto structured;
+	node_1308:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_1307;
+		goto structured;
+	node_1307:
+		if(*(cache_2+-3) > cb)
+			goto node_1306;
+		goto structured;
+	node_1306:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_1305;
+		goto structured;
+	node_1305:
+		if(*(cache_2+-2) > cb)
+			goto node_1304;
+		goto structured;
+	node_1304:
+		if(*(cache_2+-1) > cb)
+			goto node_644;
+		goto structured;
+	node_1258:
+		if(*(cache_2+-1) > cb)
+			goto node_1257;
+		goto structured;
+	node_1257:
+		if(*(cache_2+-2) > cb)
+			goto node_1256;
+		goto structured;
+	node_1256:
+		if(*cache_2 > cb)
+			goto node_1255;
+		goto structured;
+	node_1255:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1254;
+		goto structured;
+	node_1254:
+		if(*(cache_2+-3) > cb)
+			goto node_1247;
+		if(*(cache_2+-3) < c_b)
+			goto node_1250;
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_1252;
+		goto structured;
+	node_1252:
+		if(*(cache_1+2) > cb)
+			goto node_1251;
+		goto structured;
+	node_1251:
+		if(*(cache_0+3) > cb)
+			goto node_1184;
+		goto structured;
+	node_1247:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_1243;
+		if(*(cache_0 + pixel[14]) < c_b)
+			goto node_1244;
+		if(*(cache_0+3) > cb)
+			goto node_1245;
+		goto structured;
+	node_1245:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_651;
+		goto structured;
+	node_1243:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_1238;
+		if(*(cache_0 + pixel[13]) < c_b)
+			goto node_1240;
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1241;
+		goto structured;
+	node_1241:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_541;
+		goto structured;
+	node_1238:
+		if(*(cache_0+3) > cb)
+			goto node_101;
+		goto node_9;
+	node_1240:
+		if(*(cache_0+3) > cb)
+			goto node_1239;
+		goto structured;
+	node_1244:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_269;
+		goto structured;
+	node_269:
+		if(*(cache_0+3) > cb)
+			goto node_69;
+		goto structured;
+	node_1250:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1249;
+		goto structured;
+	node_1249:
+		if(*(cache_1+2) > cb)
+			goto node_1248;
+		goto structured;
+	node_1248:
+		if(*(cache_1+1) > cb)
+			goto node_1241;
+		goto structured;
+	node_1303:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1262;
+		if(*(cache_0 + pixel[1]) < c_b)
+			goto node_1302;
+		goto structured;
+	node_1262:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_1261;
+		goto structured;
+	node_1261:
+		if(*(cache_2+-1) > cb)
+			goto node_1260;
+		goto structured;
+	node_1260:
+		if(*(cache_2+-3) > cb)
+			goto node_1259;
+		goto structured;
+	node_1259:
+		if(*(cache_0+-3) > cb)
+			goto node_560;
+		goto structured;
+	node_1302:
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0+3) > cb)
+			goto node_1267;
+		if(*(cache_0+3) < c_b)
+			goto node_1295;
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+	node_1288:
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		goto node_143;
+	node_1267:
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+	node_1263:
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		goto node_1217;
+	node_1295:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1271;
+		if(*(cache_0 + pixel[4]) < c_b)
+			goto node_1285;
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_1+1) > cb)
+			goto node_1286;
+		if(*(cache_1+1) < c_b)
+			goto node_1287;
+		if(*(cache_1+2) > cb)
+			goto node_1289;
+	node_1286:
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		goto node_150;
+	node_1289:
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		goto node_1288;
+	node_1287:
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		goto node_912;
+	node_1271:
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+	node_1268:
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		goto node_318;
+	node_1285:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_1275;
+		if(*(cache_0 + pixel[5]) < c_b)
+			goto node_1282;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		goto node_580;
+	node_1275:
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		goto node_1272;
+	node_1282:
+		if(*(cache_1+2) > cb)
+			goto node_1276;
+		if(*(cache_1+2) < c_b)
+			goto node_1278;
+		goto node_1281;
+	node_1276:
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		goto node_1214;
+	node_1278:
+		if(*(cache_1+1) >= c_b)
+			goto node_1277;
+		goto success;
+	node_1277:
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		goto node_1215;
+	node_1821:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_1386;
+		if(*(cache_0 + pixel[11]) < c_b)
+			goto node_1768;
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1782;
+		if(*(cache_0 + pixel[2]) < c_b)
+			goto node_1819;
+		goto structured;
+	node_1782:
+		if(*(cache_2+-1) > cb)
+			goto node_1781;
+		goto structured;
+	node_1781:
+		if(*cache_2 > cb)
+			goto node_1780;
+		goto structured;
+	node_1780:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1779;
+		goto structured;
+	node_1779:
+		if(*(cache_2+-2) > cb)
+			goto node_1778;
+		goto structured;
+	node_1778:
+		if(*(cache_0+3) > cb)
+			goto node_1777;
+		goto structured;
+	node_1777:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1773;
+		if(*(cache_0 + pixel[4]) < c_b)
+			goto node_1776;
+		goto node_116;
+	node_1773:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_1770;
+		if(*(cache_0 + pixel[5]) < c_b)
+			goto node_1772;
+		goto node_115;
+	node_1770:
+		if(*(cache_1+2) > cb)
+			goto node_1769;
+		goto node_114;
+	node_1769:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_1542;
+	node_138:
+		if(*(cache_1+1) > cb)
+			goto success;
+		goto node_82;
+	node_1542:
+		if(*(cache_2+-3) > cb)
+			goto success;
+		goto node_35;
+	node_1772:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_1771;
+		goto structured;
+	node_1771:
+		if(*(cache_2+-3) > cb)
+			goto node_103;
+		goto structured;
+	node_1776:
+		if(*(cache_1+1) > cb||*(cache_1+1) < c_b)
+			goto node_116;
+		if(*(cache_0+-3) > cb)
+			goto node_1774;
+		goto structured;
+	node_1774:
+		if(*(cache_2+-3) > cb)
+			goto node_109;
+		goto structured;
+	node_1819:
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1788;
+		if(*(cache_0 + pixel[4]) < c_b)
+			goto node_1810;
+		if(*(cache_1+2) > cb||*(cache_1+2) < c_b)
+			goto node_1811;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		goto node_151;
+	node_1811:
+		if(*cache_2 >= c_b)
+			goto structured;
+		goto node_203;
+	node_1788:
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		goto node_143;
+	node_1810:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_1791;
+		if(*(cache_0 + pixel[5]) < c_b)
+			goto node_1809;
+	node_1358:
+		if(*cache_2 >= c_b)
+			goto structured;
+		goto node_171;
+	node_1791:
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		goto node_177;
+	node_1809:
+		if(*(cache_1+1) > cb)
+			goto node_1796;
+		if(*(cache_1+1) < c_b)
+			goto node_1800;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_0+-3) > cb)
+			goto node_1803;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+	node_1801:
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto node_172;
+		goto success;
+	node_1803:
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		goto node_1801;
+	node_1796:
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto node_1792;
+		goto node_175;
+	node_1792:
+		if(*(cache_1+2) >= c_b)
+			goto structured;
+		goto node_175;
+	node_1800:
+		if(*(cache_1+2) > cb)
+			goto node_1798;
+		if(*(cache_1+2) < c_b)
+			goto success;
+		if(*cache_2 >= c_b)
+			goto structured;
+		goto node_170;
+	node_1798:
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		goto node_1263;
+	node_1386:
+		if(*(cache_0+3) > cb)
+			goto node_1328;
+		if(*(cache_0+3) < c_b)
+			goto node_1378;
+		if(*(cache_2+-3) > cb)
+			goto node_1384;
+		goto structured;
+	node_1384:
+		if(*(cache_0+-3) > cb)
+			goto node_1383;
+		goto structured;
+	node_1383:
+		if(*cache_2 > cb)
+			goto node_1382;
+		goto structured;
+	node_1382:
+		if(*(cache_2+-1) > cb)
+			goto node_1381;
+		goto structured;
+	node_1381:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1380;
+		goto structured;
+	node_1380:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_1379;
+		goto structured;
+	node_1379:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_898;
+		goto structured;
+	node_1328:
+		if(*cache_2 > cb)
+			goto node_1327;
+		goto structured;
+	node_1327:
+		if(*(cache_2+-2) > cb)
+			goto node_1326;
+		goto structured;
+	node_1326:
+		if(*(cache_2+-1) > cb)
+			goto node_1325;
+		goto structured;
+	node_1325:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1324;
+		goto structured;
+	node_1324:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1323;
+		goto structured;
+	node_1323:
+		if(*(cache_2+-3) > cb)
+			goto node_1317;
+		if(*(cache_2+-3) < c_b)
+			goto node_1319;
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1321;
+		goto structured;
+	node_1321:
+		if(*(cache_1+2) > cb)
+			goto node_1320;
+		goto structured;
+	node_1320:
+		if(*(cache_1+1) > cb)
+			goto node_84;
+		goto structured;
+	node_1317:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1313;
+		if(*(cache_0 + pixel[4]) < c_b)
+			goto node_1315;
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_104;
+		goto structured;
+	node_1313:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_771;
+		if(*(cache_0 + pixel[14]) < c_b)
+			goto node_69;
+		goto node_1173;
+	node_1315:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_1314;
+		goto structured;
+	node_1314:
+		if(*(cache_0+-3) > cb)
+			goto node_108;
+		goto structured;
+	node_1319:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1318;
+		goto structured;
+	node_1318:
+		if(*(cache_1+1) > cb)
+			goto node_1173;
+		goto structured;
+	node_1378:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1333;
+		if(*(cache_0 + pixel[2]) < c_b)
+			goto node_1377;
+		goto structured;
+	node_1333:
+		if(*(cache_2+-1) > cb)
+			goto node_1332;
+		goto structured;
+	node_1332:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1331;
+		goto structured;
+	node_1331:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_1330;
+		goto structured;
+	node_1330:
+		if(*(cache_0+-3) > cb)
+			goto node_1329;
+		goto structured;
+	node_1329:
+		if(*cache_2 > cb)
+			goto node_88;
+		goto structured;
+	node_1377:
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1337;
+		if(*(cache_0 + pixel[4]) < c_b)
+			goto node_1370;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		goto node_1279;
+	node_1337:
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		goto node_1218;
+	node_1370:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_1342;
+		if(*(cache_0 + pixel[5]) < c_b)
+			goto node_1357;
+		if(*(cache_1+1) > cb)
+			goto node_1358;
+		if(*(cache_1+1) < c_b)
+			goto node_1365;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		goto node_1268;
+	node_1365:
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_1+2) >= c_b)
+			goto node_1360;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+	node_1343:
+		if(*cache_2 >= c_b)
+			goto structured;
+		goto node_175;
+	node_1360:
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		goto node_176;
+	node_1342:
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		goto node_319;
+	node_1357:
+		if(*(cache_1+2) > cb)
+			goto node_1346;
+		if(*(cache_1+2) < c_b)
+			goto node_1353;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		goto node_912;
+	node_1346:
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		goto node_1343;
+	node_1353:
+		if(*(cache_1+1) > cb)
+			goto node_1350;
+		if(*(cache_1+1) < c_b)
+			goto success;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+	node_1348:
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+	node_1347:
+		if(*cache_2 >= c_b)
+			goto structured;
+		goto success;
+	node_1350:
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		goto node_1348;
+	node_1768:
+		if(*(cache_0+-3) > cb)
+			goto node_1541;
+		if(*(cache_0+-3) < c_b)
+			goto node_1720;
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1733;
+		if(*(cache_0 + pixel[2]) < c_b)
+			goto node_1766;
+		goto structured;
+	node_1733:
+		if(*(cache_1+2) > cb)
+			goto node_1728;
+		if(*cache_2 > cb)
+			goto node_1731;
+		goto structured;
+	node_1731:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1730;
+		goto structured;
+	node_1730:
+		if(*(cache_0+3) > cb)
+			goto node_1729;
+		goto structured;
+	node_1729:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_575;
+		goto structured;
+	node_1728:
+		if(*cache_2 > cb)
+			goto node_1727;
+		goto structured;
+	node_1727:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1726;
+		goto structured;
+	node_1726:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1725;
+		goto structured;
+	node_1725:
+		if(*(cache_2+-1) > cb)
+			goto node_1724;
+		goto structured;
+	node_1724:
+		if(*(cache_0+3) > cb)
+			goto node_1723;
+		goto structured;
+	node_1723:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_1722;
+		goto node_258;
+	node_1722:
+		if(*(cache_2+-3) > cb)
+			goto node_66;
+		if(*(cache_1+1) > cb)
+			goto node_66;
+		goto structured;
+	node_1766:
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		if(*(cache_1+2) > cb)
+			goto node_1741;
+		if(*(cache_1+2) < c_b)
+			goto node_1757;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		goto node_320;
+	node_1741:
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto node_1735;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		goto node_1347;
+	node_1735:
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+		goto node_176;
+	node_1757:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_1747;
+		if(*(cache_0 + pixel[5]) < c_b)
+			goto node_1754;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		goto node_171;
+	node_1747:
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		goto node_143;
+	node_1754:
+		if(*(cache_1+1) > cb)
+			goto node_1753;
+		if(*(cache_1+1) < c_b)
+			goto success;
+	node_1752:
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		goto node_151;
+	node_1753:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_1750;
+		goto node_1752;
+	node_1750:
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		goto node_511;
+	node_1541:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1398;
+		if(*(cache_0 + pixel[4]) < c_b)
+			goto node_1532;
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_1539;
+		goto structured;
+	node_1539:
+		if(*(cache_2+-2) > cb)
+			goto node_1538;
+		goto structured;
+	node_1538:
+		if(*(cache_2+-3) > cb)
+			goto node_1537;
+		goto structured;
+	node_1537:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1536;
+		goto structured;
+	node_1536:
+		if(*cache_2 > cb)
+			goto node_1535;
+		goto structured;
+	node_1535:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1534;
+		goto structured;
+	node_1534:
+		if(*(cache_0+3) > cb)
+			goto node_1533;
+		goto structured;
+	node_1533:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_3;
+		goto structured;
+	node_1398:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1397;
+		goto structured;
+	node_1397:
+		if(*cache_2 > cb)
+			goto node_1396;
+		goto structured;
+	node_1396:
+		if(*(cache_2+-2) > cb)
+			goto node_1395;
+		goto structured;
+	node_1395:
+		if(*(cache_2+-1) > cb)
+			goto node_1394;
+		goto structured;
+	node_1394:
+		if(*(cache_0+3) > cb)
+			goto node_1393;
+		goto structured;
+	node_1393:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1392;
+		goto structured;
+	node_1392:
+		if(*(cache_2+-3) > cb)
+			goto node_1387;
+		if(*(cache_2+-3) < c_b)
+			goto node_1389;
+		goto node_1391;
+	node_1387:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_771;
+		if(*(cache_0 + pixel[14]) < c_b)
+			goto node_1173;
+		goto node_69;
+	node_1389:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_1388;
+		goto structured;
+	node_1388:
+		if(*(cache_1+1) > cb)
+			goto node_68;
+		goto structured;
+	node_1532:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_1439;
+		if(*(cache_0 + pixel[5]) < c_b)
+			goto node_1507;
+		if(*(cache_1+2) > cb)
+			goto node_1523;
+		if(*cache_2 > cb)
+			goto node_1526;
+		if(*cache_2 < c_b)
+			goto node_1529;
+		goto structured;
+	node_1526:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1525;
+		goto structured;
+	node_1525:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1524;
+		goto structured;
+	node_1524:
+		if(*(cache_0+3) > cb)
+			goto node_76;
+		goto structured;
+	node_1529:
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		goto node_171;
+	node_1523:
+		if(*(cache_2+-3) > cb)
+			goto node_1517;
+		if(*(cache_2+-3) < c_b)
+			goto node_1522;
+		goto structured;
+	node_1517:
+		if(*cache_2 > cb)
+			goto node_1516;
+		goto structured;
+	node_1516:
+		if(*(cache_2+-1) > cb)
+			goto node_1515;
+		goto structured;
+	node_1515:
+		if(*(cache_1+1) >= c_b)
+			goto node_1510;
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_1513;
+		goto structured;
+	node_1513:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1512;
+		goto structured;
+	node_1512:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1511;
+		goto structured;
+	node_1511:
+		if(*(cache_0+3) > cb)
+			goto node_477;
+		goto structured;
+	node_1510:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1509;
+		goto structured;
+	node_1509:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1508;
+		goto structured;
+	node_1508:
+		if(*(cache_0+3) > cb)
+			goto node_559;
+		goto structured;
+	node_1522:
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		goto node_1286;
+	node_1439:
+		if(*(cache_1+1) > cb)
+			goto node_1408;
+		if(*(cache_1+1) < c_b)
+			goto node_1423;
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_1430;
+		if(*(cache_0 + pixel[13]) < c_b)
+			goto node_1437;
+		goto structured;
+	node_1430:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1429;
+		goto structured;
+	node_1429:
+		if(*(cache_0+3) > cb)
+			goto node_1428;
+		goto structured;
+	node_1428:
+		if(*(cache_2+-2) > cb)
+			goto node_1427;
+		goto structured;
+	node_1427:
+		if(*(cache_2+-1) > cb)
+			goto node_1426;
+		goto structured;
+	node_1426:
+		if(*cache_2 > cb)
+			goto node_1425;
+		goto structured;
+	node_1425:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_1424;
+		goto structured;
+	node_1424:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_82;
+		goto structured;
+	node_1437:
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		goto node_531;
+	node_1408:
+		if(*(cache_2+-1) > cb)
+			goto node_1403;
+		if(*(cache_2+-1) < c_b)
+			goto node_1407;
+		goto structured;
+	node_1403:
+		if(*cache_2 > cb)
+			goto node_1402;
+		goto structured;
+	node_1402:
+		if(*(cache_0+3) > cb)
+			goto node_1401;
+		goto structured;
+	node_1401:
+		if(*(cache_2+-2) > cb)
+			goto node_1400;
+		goto structured;
+	node_1400:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1399;
+		goto structured;
+	node_1399:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_997;
+		goto structured;
+	node_1407:
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		goto node_208;
+	node_1423:
+		if(*(cache_2+-2) > cb)
+			goto node_1415;
+		if(*(cache_2+-2) < c_b)
+			goto node_1422;
+		goto structured;
+	node_1415:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1414;
+		goto structured;
+	node_1414:
+		if(*(cache_2+-1) > cb)
+			goto node_1413;
+		goto structured;
+	node_1413:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1412;
+		goto structured;
+	node_1412:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_1411;
+		goto structured;
+	node_1411:
+		if(*(cache_2+-3) > cb)
+			goto node_1410;
+		goto structured;
+	node_1410:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_1409;
+		goto structured;
+	node_1409:
+		if(*cache_2 > cb)
+			goto node_541;
+		goto structured;
+	node_1422:
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		goto node_1416;
+	node_1507:
+		if(*(cache_1+2) > cb)
+			goto node_1478;
+		if(*(cache_1+2) < c_b)
+			goto node_1494;
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_1498;
+		if(*(cache_0 + pixel[13]) < c_b)
+			goto node_1499;
+		if(*(cache_1+1) > cb||*(cache_1+1) < c_b)
+			goto node_1499;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		goto node_1286;
+	node_1499:
+		if(*cache_2 >= c_b)
+			goto structured;
+	node_1497:
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		goto node_170;
+	node_1498:
+		if(*cache_2 > cb)
+			goto node_544;
+		if(*cache_2 < c_b)
+			goto node_1497;
+		goto structured;
+	node_1478:
+		if(*(cache_1+1) > cb)
+			goto node_1451;
+		if(*(cache_1+1) < c_b)
+			goto node_1464;
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1471;
+		if(*(cache_0 + pixel[1]) < c_b)
+			goto node_1476;
+		goto structured;
+	node_1471:
+		if(*(cache_2+-3) > cb)
+			goto node_1470;
+		goto structured;
+	node_1470:
+		if(*cache_2 > cb)
+			goto node_1469;
+		goto structured;
+	node_1469:
+		if(*(cache_2+-1) > cb)
+			goto node_1468;
+		goto structured;
+	node_1468:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1467;
+		goto structured;
+	node_1467:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_1466;
+		goto structured;
+	node_1466:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_1465;
+		goto structured;
+	node_1465:
+		if(*(cache_0+3) > cb)
+			goto node_66;
+		goto structured;
+	node_1476:
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		goto node_549;
+	node_1451:
+		if(*(cache_2+-2) > cb)
+			goto node_1445;
+		if(*(cache_2+-2) < c_b)
+			goto node_1450;
+		goto structured;
+	node_1445:
+		if(*cache_2 > cb)
+			goto node_1444;
+		goto structured;
+	node_1444:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1443;
+		goto structured;
+	node_1443:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1442;
+		goto structured;
+	node_1442:
+		if(*(cache_0+3) > cb)
+			goto node_1441;
+		goto structured;
+	node_1441:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_1440;
+		goto structured;
+	node_1440:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_756;
+		goto structured;
+	node_1450:
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		goto node_1048;
+	node_1464:
+		if(*(cache_0+3) > cb)
+			goto node_1457;
+		if(*(cache_0+3) < c_b)
+			goto node_1463;
+		goto structured;
+	node_1457:
+		if(*cache_2 > cb)
+			goto node_1456;
+		goto structured;
+	node_1456:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1455;
+		goto structured;
+	node_1455:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1454;
+		goto structured;
+	node_1454:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_1453;
+		goto structured;
+	node_1453:
+		if(*(cache_2+-3) > cb)
+			goto node_1452;
+		goto structured;
+	node_1452:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_828;
+		goto structured;
+	node_1463:
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		goto node_603;
+	node_1494:
+		if(*(cache_0+3) > cb)
+			goto node_1482;
+		if(*(cache_0+3) < c_b)
+			goto node_1493;
+		goto structured;
+	node_1482:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_1481;
+		goto structured;
+	node_1481:
+		if(*(cache_2+-3) > cb)
+			goto node_1480;
+		goto structured;
+	node_1480:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1479;
+		goto structured;
+	node_1479:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1306;
+		goto structured;
+	node_1493:
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_1+1) > cb)
+			goto node_1485;
+		if(*(cache_1+1) < c_b)
+			goto success;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto node_1486;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		goto node_178;
+	node_1486:
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		goto node_176;
+	node_1485:
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		goto node_532;
+	node_1720:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_1610;
+		if(*(cache_0 + pixel[13]) < c_b)
+			goto node_1696;
+		if(*(cache_0+3) > cb)
+			goto node_1706;
+		if(*(cache_0+3) < c_b)
+			goto node_1718;
+		goto structured;
+	node_1706:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1705;
+		goto structured;
+	node_1705:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_1704;
+		goto structured;
+	node_1704:
+		if(*(cache_2+-1) > cb)
+			goto node_1703;
+		goto structured;
+	node_1703:
+		if(*cache_2 > cb)
+			goto node_1702;
+		goto structured;
+	node_1702:
+		if(*(cache_1+2) > cb)
+			goto node_1699;
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1700;
+		goto structured;
+	node_1700:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_88;
+		goto structured;
+	node_1699:
+		if(*(cache_2+-2) > cb)
+			goto node_1698;
+		goto structured;
+	node_1698:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1697;
+		goto structured;
+	node_1697:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1542;
+		goto structured;
+	node_1718:
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+		if(*(cache_1+2) > cb)
+			goto node_1711;
+		if(*(cache_1+2) < c_b)
+			goto node_1712;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		goto node_170;
+	node_1711:
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		goto node_176;
+	node_1712:
+		if(*(cache_1+1) >= c_b)
+			goto node_518;
+		goto success;
+	node_1610:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_1552;
+		if(*(cache_0 + pixel[5]) < c_b)
+			goto node_1601;
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1608;
+		goto structured;
+	node_1608:
+		if(*(cache_2+-3) > cb)
+			goto node_1607;
+		goto structured;
+	node_1607:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1606;
+		goto structured;
+	node_1606:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1605;
+		goto structured;
+	node_1605:
+		if(*(cache_2+-1) > cb)
+			goto node_1604;
+		goto structured;
+	node_1604:
+		if(*cache_2 > cb)
+			goto node_1603;
+		goto structured;
+	node_1603:
+		if(*(cache_2+-2) > cb)
+			goto node_1602;
+		goto structured;
+	node_1602:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_541;
+		goto structured;
+	node_1552:
+		if(*(cache_0+3) > cb)
+			goto node_1551;
+		goto structured;
+	node_1551:
+		if(*(cache_2+-1) > cb)
+			goto node_1550;
+		goto structured;
+	node_1550:
+		if(*(cache_2+-2) > cb)
+			goto node_1549;
+		goto structured;
+	node_1549:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1548;
+		goto structured;
+	node_1548:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1547;
+		goto structured;
+	node_1547:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1546;
+		goto structured;
+	node_1546:
+		if(*cache_2 > cb)
+			goto node_1545;
+		goto structured;
+	node_1545:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_131;
+		if(*(cache_0 + pixel[14]) < c_b)
+			goto node_1543;
+		if(*(cache_1+2) > cb)
+			goto node_138;
+		goto structured;
+	node_131:
+		if(*(cache_2+-3) > cb)
+			goto success;
+		goto node_52;
+	node_1543:
+		if(*(cache_1+2) > cb)
+			goto node_1542;
+		goto structured;
+	node_1601:
+		if(*(cache_1+2) > cb)
+			goto node_1564;
+		if(*(cache_1+2) < c_b)
+			goto node_1595;
+		if(*cache_2 > cb)
+			goto node_1599;
+		if(*cache_2 < c_b)
+			goto node_1563;
+		goto structured;
+	node_1599:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1598;
+		goto structured;
+	node_1598:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1597;
+		goto structured;
+	node_1597:
+		if(*(cache_0+3) > cb)
+			goto node_1596;
+		goto structured;
+	node_1596:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_60;
+		goto structured;
+	node_1563:
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+		goto node_170;
+	node_1564:
+		if(*cache_2 > cb)
+			goto node_1559;
+		if(*cache_2 < c_b)
+			goto node_1563;
+		goto structured;
+	node_1559:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1558;
+		goto structured;
+	node_1558:
+		if(*(cache_0+3) > cb)
+			goto node_1557;
+		goto structured;
+	node_1557:
+		if(*(cache_2+-2) > cb)
+			goto node_1556;
+		goto structured;
+	node_1556:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1555;
+		goto structured;
+	node_1555:
+		if(*(cache_2+-1) > cb)
+			goto node_1554;
+		goto structured;
+	node_1554:
+		if(*(cache_2+-3) > cb)
+			goto node_1553;
+		goto structured;
+	node_1553:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_252;
+		goto structured;
+	node_1595:
+		if(*(cache_1+1) > cb)
+			goto node_1575;
+		if(*(cache_1+1) < c_b)
+			goto node_1583;
+		if(*cache_2 > cb)
+			goto node_1589;
+		if(*cache_2 < c_b)
+			goto node_1593;
+		goto structured;
+	node_1589:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1588;
+		goto structured;
+	node_1588:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1587;
+		goto structured;
+	node_1587:
+		if(*(cache_2+-3) > cb)
+			goto node_1586;
+		goto structured;
+	node_1586:
+		if(*(cache_2+-1) > cb)
+			goto node_1585;
+		goto structured;
+	node_1585:
+		if(*(cache_0+3) > cb)
+			goto node_1584;
+		goto structured;
+	node_1584:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_477;
+		goto structured;
+	node_1593:
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+		goto node_151;
+	node_1575:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1570;
+		if(*(cache_0 + pixel[4]) < c_b)
+			goto node_1574;
+		goto structured;
+	node_1570:
+		if(*(cache_0+3) > cb)
+			goto node_1569;
+		goto structured;
+	node_1569:
+		if(*cache_2 > cb)
+			goto node_1568;
+		goto structured;
+	node_1568:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1567;
+		goto structured;
+	node_1567:
+		if(*(cache_2+-3) > cb)
+			goto node_1566;
+		goto structured;
+	node_1566:
+		if(*(cache_2+-2) > cb)
+			goto node_1565;
+		goto structured;
+	node_1565:
+		if(*(cache_2+-1) > cb)
+			goto node_496;
+		goto structured;
+	node_1574:
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		goto node_151;
+	node_1583:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1582;
+		if(*(cache_0 + pixel[4]) < c_b)
+			goto node_674;
+		goto structured;
+	node_1582:
+		if(*cache_2 > cb)
+			goto node_1581;
+		goto structured;
+	node_1581:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1580;
+		goto structured;
+	node_1580:
+		if(*(cache_2+-3) > cb)
+			goto node_1579;
+		goto structured;
+	node_1579:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_1578;
+		goto structured;
+	node_1578:
+		if(*(cache_2+-2) > cb)
+			goto node_1577;
+		goto structured;
+	node_1577:
+		if(*(cache_0+3) > cb)
+			goto node_1576;
+		goto structured;
+	node_1576:
+		if(*(cache_2+-1) > cb)
+			goto node_725;
+		goto structured;
+	node_1696:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_1660;
+		if(*(cache_0 + pixel[14]) < c_b)
+			goto node_1683;
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_1688;
+		if(*(cache_0 + pixel[5]) < c_b)
+			goto node_1694;
+		goto structured;
+	node_1688:
+		if(*cache_2 > cb)
+			goto node_1687;
+		goto structured;
+	node_1687:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1686;
+		goto structured;
+	node_1686:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1685;
+		goto structured;
+	node_1685:
+		if(*(cache_0+3) > cb)
+			goto node_1684;
+		goto structured;
+	node_1684:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_165;
+		goto structured;
+	node_165:
+		if(*(cache_1+2) > cb)
+			goto node_164;
+		goto structured;
+	node_164:
+		if(*(cache_2+-2) > cb)
+			goto node_139;
+		goto structured;
+	node_139:
+		if(*(cache_2+-1) > cb)
+			goto node_138;
+		goto structured;
+	node_1694:
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+		if(*(cache_1+1) >= c_b)
+			goto node_1692;
+		goto node_172;
+	node_1692:
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+	node_1619:
+		if(*(cache_1+2) >= c_b)
+			goto structured;
+		goto node_151;
+	node_1660:
+		if(*(cache_1+1) > cb)
+			goto node_1625;
+		if(*(cache_1+1) < c_b)
+			goto node_1648;
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1650;
+		if(*(cache_0 + pixel[2]) < c_b)
+			goto node_1658;
+		goto structured;
+	node_1650:
+		if(*cache_2 > cb)
+			goto node_1649;
+		goto structured;
+	node_1649:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1644;
+		goto structured;
+	node_1644:
+		if(*(cache_0+3) > cb)
+			goto node_1643;
+		goto structured;
+	node_1643:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1642;
+		goto structured;
+	node_1642:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_6;
+		goto structured;
+	node_1658:
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_1+2) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+		goto node_175;
+	node_1625:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1618;
+		if(*(cache_0 + pixel[1]) < c_b)
+			goto node_1624;
+		goto structured;
+	node_1618:
+		if(*(cache_2+-2) > cb)
+			goto node_1617;
+		goto structured;
+	node_1617:
+		if(*(cache_2+-1) > cb)
+			goto node_1616;
+		goto structured;
+	node_1616:
+		if(*(cache_0+3) > cb)
+			goto node_1615;
+		goto structured;
+	node_1615:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1614;
+		goto structured;
+	node_1614:
+		if(*cache_2 > cb)
+			goto node_1613;
+		goto structured;
+	node_1613:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1612;
+		goto structured;
+	node_1612:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_1611;
+		goto structured;
+	node_1611:
+		if(*(cache_1+2) > cb)
+			goto success;
+		goto node_82;
+	node_1624:
+		if(*cache_2 >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+		goto node_1619;
+	node_1648:
+		if(*(cache_1+2) > cb)
+			goto node_1633;
+		if(*(cache_1+2) < c_b)
+			goto node_1641;
+		if(*cache_2 > cb)
+			goto node_1646;
+		goto structured;
+	node_1646:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1645;
+		goto structured;
+	node_1645:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1644;
+		goto structured;
+	node_1633:
+		if(*(cache_2+-3) > cb)
+			goto node_1632;
+		goto structured;
+	node_1632:
+		if(*cache_2 > cb)
+			goto node_1631;
+		goto structured;
+	node_1631:
+		if(*(cache_0+3) > cb)
+			goto node_1630;
+		goto structured;
+	node_1630:
+		if(*(cache_2+-2) > cb)
+			goto node_1629;
+		goto structured;
+	node_1629:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_1628;
+		goto structured;
+	node_1628:
+		if(*(cache_2+-1) > cb)
+			goto node_1627;
+		goto structured;
+	node_1627:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1626;
+		goto structured;
+	node_1626:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1153;
+		goto structured;
+	node_1641:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1640;
+		if(*(cache_0 + pixel[4]) < c_b)
+			goto node_152;
+		goto structured;
+	node_1640:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1639;
+		goto structured;
+	node_1639:
+		if(*(cache_2+-2) > cb)
+			goto node_1638;
+		goto structured;
+	node_1638:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_1637;
+		goto structured;
+	node_1637:
+		if(*cache_2 > cb)
+			goto node_1636;
+		goto structured;
+	node_1636:
+		if(*(cache_2+-1) > cb)
+			goto node_1635;
+		goto structured;
+	node_1635:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1634;
+		goto structured;
+	node_1634:
+		if(*(cache_0+3) > cb)
+			goto node_82;
+		goto structured;
+	node_1683:
+		if(*(cache_2+-3) > cb)
+			goto node_1668;
+		if(*(cache_2+-3) < c_b)
+			goto node_1674;
+		if(*(cache_1+2) > cb)
+			goto node_1681;
+		if(*(cache_1+2) < c_b)
+			goto node_810;
+		goto structured;
+	node_1681:
+		if(*cache_2 > cb)
+			goto node_1680;
+		goto structured;
+	node_1680:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1679;
+		goto structured;
+	node_1679:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1678;
+		goto structured;
+	node_1678:
+		if(*(cache_0+3) > cb)
+			goto node_1677;
+		goto structured;
+	node_1677:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1676;
+		goto structured;
+	node_1676:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_1675;
+		goto structured;
+	node_1675:
+		if(*(cache_1+1) > cb)
+			goto node_5;
+		goto structured;
+	node_1668:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_1666;
+		if(*(cache_0 + pixel[5]) < c_b)
+			goto node_1667;
+		goto structured;
+	node_1666:
+		if(*cache_2 > cb)
+			goto node_1665;
+		goto structured;
+	node_1665:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_1664;
+		goto structured;
+	node_1664:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_1663;
+		goto structured;
+	node_1663:
+		if(*(cache_0+3) > cb)
+			goto node_1662;
+		goto structured;
+	node_1662:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_1661;
+		goto structured;
+	node_1661:
+		if(*(cache_1+2) > cb)
+			goto node_5;
+		goto structured;
+	node_1667:
+		if(*(cache_1+1) >= c_b)
+			goto structured;
+		goto node_172;
+	node_1674:
+		if(*(cache_2+-2) > cb)
+			goto node_1673;
+		if(*(cache_2+-2) < c_b)
+			goto node_396;
+		goto node_297;
+	node_1673:
+		if(*(cache_1+1) > cb)
+			goto node_1672;
+		if(*(cache_1+1) < c_b)
+			goto node_172;
+		goto structured;
+	node_1672:
+		if(*(cache_2+-1) > cb)
+			goto node_1671;
+		goto structured;
+	node_1671:
+		if(*cache_2 > cb)
+			goto node_1670;
+		goto structured;
+	node_1670:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_1669;
+		goto structured;
+	node_1669:
+		if(*(cache_1+2) > cb)
+			goto node_641;
+		goto structured;
+	node_396:
+		if(*(cache_2+-1) >= c_b)
+			goto node_296;
+		goto success;
+	node_466:
+		if(*cache_2 > cb)
+			goto node_250;
+		if(*cache_2 < c_b)
+			goto node_444;
+		if(*cache_1 > cb)
+			goto node_454;
+		if(*cache_1 < c_b)
+			goto node_464;
+		goto homogeneous;
+	node_454:
+		if(*(cache_1+-1) > cb)
+			goto node_453;
+		if(*(cache_1+-1) < c_b)
+			goto structured;
+		goto homogeneous;
+	node_453:
+		if(*(cache_0 + pixel[10]) > cb)
+			goto node_452;
+		if(*(cache_0 + pixel[10]) < c_b)
+			goto structured;
+		goto homogeneous;
+	node_452:
+		if(*(cache_1+1) > cb)
+			goto node_450;
+		if(*(cache_1+1) < c_b)
+			goto node_264;
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_263;
+		if(*(cache_0 + pixel[11]) < c_b)
+			goto structured;
+		goto homogeneous;
+	node_450:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_447;
+		goto node_449;
+	node_447:
+		if(*(cache_1+2) > cb)
+			goto node_446;
+		goto node_259;
+	node_446:
+		if(*(cache_0+-3) > cb)
+			goto node_255;
+		goto node_445;
+	node_255:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_254;
+		goto node_115;
+	node_254:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_251;
+		goto node_253;
+	node_464:
+		if(*(cache_1+-1) > cb)
+			goto structured;
+		if(*(cache_1+-1) < c_b)
+			goto node_463;
+		goto homogeneous;
+	node_463:
+		if(*(cache_0 + pixel[10]) > cb)
+			goto structured;
+		if(*(cache_0 + pixel[10]) < c_b)
+			goto node_462;
+		goto homogeneous;
+	node_462:
+		if(*(cache_1+1) > cb)
+			goto node_204;
+		if(*(cache_1+1) < c_b)
+			goto node_460;
+		goto node_461;
+	node_460:
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto node_456;
+		if(*(cache_1+2) >= c_b)
+			goto node_209;
+		if(*(cache_0+-3) >= c_b)
+			goto node_457;
+	node_219:
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto node_213;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto node_215;
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto node_216;
+		goto success;
+	node_215:
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		goto node_214;
+	node_457:
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+	node_211:
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		goto node_210;
+	node_456:
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		goto node_455;
+	node_250:
+		if(*cache_1 > cb)
+			goto node_100;
+		if(*cache_1 < c_b)
+			goto node_240;
+		if(*(cache_2+-2) > cb)
+			goto node_248;
+		if(*(cache_2+-2) < c_b)
+			goto structured;
+		goto homogeneous;
+	node_248:
+		if(*(cache_2+-1) > cb)
+			goto node_247;
+		if(*(cache_2+-1) < c_b)
+			goto structured;
+		goto homogeneous;
+	node_247:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_243;
+		if(*(cache_0 + pixel[1]) < c_b)
+			goto node_245;
+		if(*(cache_1+-1) > cb)
+			goto node_244;
+		if(*(cache_1+-1) < c_b)
+			goto structured;
+		goto homogeneous;
+	node_244:
+		if(*(cache_0 + pixel[10]) > cb)
+			goto node_117;
+		goto structured;
+	node_243:
+		if(*(cache_2+-3) > cb)
+			goto node_242;
+	node_94:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_74;
+		goto structured;
+	node_74:
+		if(*(cache_0+3) > cb)
+			goto node_72;
+		goto structured;
+	node_72:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_54;
+		goto structured;
+	node_242:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_107;
+		if(*(cache_0 + pixel[10]) > cb)
+			goto node_111;
+		goto structured;
+	node_111:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_110;
+		goto structured;
+	node_107:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_106;
+		goto node_91;
+	node_106:
+		if(*(cache_0+3) > cb)
+			goto node_102;
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_104;
+		goto structured;
+	node_102:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_101;
+		goto node_85;
+	node_245:
+		if(*(cache_1+-1) > cb)
+			goto node_244;
+		goto structured;
+	node_100:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_81;
+		if(*(cache_0 + pixel[1]) < c_b)
+			goto node_98;
+		if(*(cache_1+-1) > cb)
+			goto node_97;
+		if(*(cache_1+-1) < c_b)
+			goto structured;
+		goto homogeneous;
+	node_97:
+		if(*(cache_0 + pixel[10]) > cb)
+			goto node_96;
+		goto structured;
+	node_96:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_95;
+		goto structured;
+	node_95:
+		if(*(cache_0+-3) > cb)
+			goto node_93;
+		goto node_94;
+	node_93:
+		if(*(cache_1+1) > cb)
+			goto node_92;
+		goto node_76;
+	node_92:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_89;
+		goto node_91;
+	node_89:
+		if(*(cache_1+2) > cb)
+			goto node_86;
+		goto node_88;
+	node_86:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_83;
+		goto node_85;
+	node_83:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto success;
+		goto node_82;
+	node_81:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_65;
+		if(*(cache_0 + pixel[10]) > cb)
+			goto node_79;
+		goto structured;
+	node_79:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_78;
+		goto structured;
+	node_78:
+		if(*(cache_0+-3) > cb)
+			goto node_77;
+		goto structured;
+	node_77:
+		if(*(cache_1+-1) > cb)
+			goto node_75;
+		goto node_76;
+	node_75:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_73;
+		goto node_74;
+	node_73:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_71;
+		goto node_72;
+	node_71:
+		if(*(cache_1+1) > cb)
+			goto node_70;
+		goto node_6;
+	node_70:
+		if(*(cache_2+-3) > cb)
+			goto node_67;
+		goto node_69;
+	node_67:
+		if(*(cache_1+2) > cb)
+			goto success;
+		goto node_66;
+	node_65:
+		if(*(cache_0+3) > cb)
+			goto node_50;
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_63;
+		goto structured;
+	node_63:
+		if(*(cache_0+-3) > cb)
+			goto node_62;
+		goto structured;
+	node_62:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_61;
+		goto structured;
+	node_61:
+		if(*(cache_0 + pixel[10]) > cb)
+			goto node_59;
+		goto node_60;
+	node_59:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_56;
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_57;
+		goto structured;
+	node_57:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_40;
+		goto structured;
+	node_40:
+		if(*(cache_1+2) > cb)
+			goto node_39;
+		goto structured;
+	node_39:
+		if(*(cache_1+1) > cb)
+			goto node_38;
+		goto structured;
+	node_38:
+		if(*(cache_1+-1) > cb)
+			goto success;
+		goto structured;
+	node_56:
+		if(*(cache_1+-1) > cb)
+			goto node_55;
+		goto node_6;
+	node_55:
+		if(*(cache_2+-3) > cb)
+			goto node_53;
+		goto node_54;
+	node_53:
+		if(*(cache_2+-2) > cb)
+			goto node_51;
+		goto node_52;
+	node_51:
+		if(*(cache_1+1) > cb)
+			goto success;
+		goto node_3;
+	node_50:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_34;
+		if(*(cache_0+-3) > cb)
+			goto node_48;
+		goto structured;
+	node_48:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_47;
+		goto structured;
+	node_47:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_46;
+		goto structured;
+	node_46:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_45;
+		goto node_6;
+	node_45:
+		if(*(cache_2+-3) > cb)
+			goto node_42;
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_43;
+		goto structured;
+	node_43:
+		if(*(cache_1+2) > cb)
+			goto node_21;
+		goto structured;
+	node_21:
+		if(*(cache_1+1) > cb)
+			goto node_20;
+		goto structured;
+	node_20:
+		if(*(cache_1+-1) > cb)
+			goto node_19;
+		goto structured;
+	node_42:
+		if(*(cache_0 + pixel[10]) > cb)
+			goto node_41;
+		goto node_5;
+	node_41:
+		if(*(cache_2+-2) > cb)
+			goto node_37;
+		goto node_40;
+	node_37:
+		if(*(cache_1+-1) > cb)
+			goto node_36;
+		goto node_3;
+	node_36:
+		if(*(cache_2+-1) > cb)
+			goto success;
+		goto node_35;
+	node_34:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_18;
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_32;
+		goto structured;
+	node_32:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_31;
+		goto structured;
+	node_31:
+		if(*(cache_2+-3) > cb)
+			goto node_30;
+		goto structured;
+	node_30:
+		if(*(cache_0+-3) > cb)
+			goto node_29;
+		goto node_5;
+	node_29:
+		if(*(cache_2+-2) > cb)
+			goto node_23;
+		if(*(cache_1+2) > cb)
+			goto node_27;
+		goto structured;
+	node_27:
+		if(*(cache_1+1) > cb)
+			goto node_26;
+		goto structured;
+	node_26:
+		if(*(cache_1+-1) > cb)
+			goto node_25;
+		goto structured;
+	node_23:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_22;
+		goto node_3;
+	node_22:
+		if(*(cache_2+-1) > cb)
+			goto success;
+		goto node_21;
+	node_18:
+		if(*(cache_1+2) > cb)
+			goto node_7;
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_16;
+		goto structured;
+	node_16:
+		if(*(cache_2+-3) > cb)
+			goto node_15;
+		goto structured;
+	node_15:
+		if(*(cache_2+-2) > cb)
+			goto node_14;
+		goto structured;
+	node_14:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_13;
+		goto node_3;
+	node_13:
+		if(*(cache_2+-1) > cb)
+			goto success;
+		if(*(cache_1+1) > cb)
+			goto node_11;
+		goto structured;
+	node_11:
+		if(*(cache_1+-1) > cb)
+			goto node_10;
+		goto structured;
+	node_7:
+		if(*(cache_1+1) > cb)
+			goto node_4;
+		goto node_6;
+	node_4:
+		if(*(cache_1+-1) > cb)
+			goto success;
+		goto node_3;
+	node_98:
+		if(*(cache_1+-1) > cb)
+			goto node_97;
+		goto structured;
+	node_240:
+		if(*(cache_0 + pixel[10]) > cb)
+			goto node_121;
+		if(*(cache_0 + pixel[10]) < c_b)
+			goto node_232;
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_238;
+		if(*(cache_0 + pixel[1]) < c_b)
+			goto structured;
+		goto homogeneous;
+	node_238:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_237;
+		goto structured;
+	node_237:
+		if(*(cache_2+-2) > cb)
+			goto node_236;
+		goto structured;
+	node_236:
+		if(*(cache_2+-1) > cb)
+			goto node_235;
+		goto structured;
+	node_235:
+		if(*(cache_0+3) > cb)
+			goto node_234;
+		goto node_117;
+	node_234:
+		if(*(cache_2+-3) > cb)
+			goto node_233;
+		goto node_72;
+	node_233:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_123;
+		goto node_110;
+	node_123:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_122;
+		goto node_69;
+	node_121:
+		if(*(cache_2+-2) > cb)
+			goto node_120;
+		goto structured;
+	node_120:
+		if(*(cache_2+-1) > cb)
+			goto node_119;
+		goto structured;
+	node_119:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_113;
+		if(*(cache_1+-1) > cb)
+			goto node_117;
+		goto structured;
+	node_113:
+		if(*(cache_2+-3) > cb)
+			goto node_112;
+		goto node_94;
+	node_112:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_107;
+		goto node_111;
+	node_232:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_202;
+		if(*(cache_0 + pixel[2]) < c_b)
+			goto node_224;
+		if(*(cache_1+-1) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+	node_228:
+		if(*(cache_1+1) >= c_b)
+			goto node_171;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto node_206;
+		if(*(cache_1+2) >= c_b)
+			goto node_177;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto node_210;
+	node_179:
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto node_178;
+		goto success;
+	node_202:
+		if(*(cache_0+-3) > cb)
+			goto node_130;
+		if(*(cache_0+-3) < c_b)
+			goto node_193;
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_200;
+		goto structured;
+	node_200:
+		if(*(cache_0+3) > cb)
+			goto node_199;
+		goto structured;
+	node_199:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_198;
+		goto structured;
+	node_198:
+		if(*(cache_2+-2) > cb)
+			goto node_197;
+		goto structured;
+	node_197:
+		if(*(cache_2+-1) > cb)
+			goto node_196;
+		goto structured;
+	node_196:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_195;
+		goto node_115;
+	node_195:
+		if(*(cache_2+-3) > cb)
+			goto node_194;
+		goto node_52;
+	node_130:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_129;
+		goto structured;
+	node_129:
+		if(*(cache_2+-2) > cb)
+			goto node_128;
+		goto structured;
+	node_128:
+		if(*(cache_2+-1) > cb)
+			goto node_127;
+		goto structured;
+	node_127:
+		if(*(cache_0+3) > cb)
+			goto node_125;
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_115;
+		goto structured;
+	node_125:
+		if(*(cache_2+-3) > cb)
+			goto node_124;
+		goto node_72;
+	node_124:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_123;
+		goto node_109;
+	node_193:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_169;
+		if(*(cache_0 + pixel[4]) < c_b)
+			goto node_185;
+		if(*(cache_1+-1) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+	node_188:
+		if(*(cache_1+1) >= c_b)
+			goto node_151;
+		if(*(cache_2+-3) >= c_b)
+			goto node_173;
+		if(*(cache_1+2) >= c_b)
+			goto node_175;
+		goto success;
+	node_169:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_137;
+		if(*(cache_0 + pixel[14]) < c_b)
+			goto node_163;
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_167;
+		goto structured;
+	node_167:
+		if(*(cache_0+3) > cb)
+			goto node_166;
+		goto structured;
+	node_166:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_165;
+		goto structured;
+	node_137:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_136;
+		goto structured;
+	node_136:
+		if(*(cache_0+3) > cb)
+			goto node_135;
+		goto structured;
+	node_135:
+		if(*(cache_2+-2) > cb)
+			goto node_134;
+		goto structured;
+	node_134:
+		if(*(cache_2+-1) > cb)
+			goto node_133;
+		goto structured;
+	node_133:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_131;
+		goto node_132;
+	node_163:
+		if(*(cache_1+2) > cb)
+			goto node_149;
+		if(*(cache_1+2) < c_b)
+			goto node_157;
+		if(*(cache_1+-1) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+	node_144:
+		if(*(cache_1+1) >= c_b)
+			goto node_143;
+		goto success;
+	node_149:
+		if(*(cache_2+-2) > cb)
+			goto node_142;
+		if(*(cache_2+-2) < c_b)
+			goto node_148;
+		goto structured;
+	node_142:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_141;
+		goto structured;
+	node_141:
+		if(*(cache_0+3) > cb)
+			goto node_140;
+		goto structured;
+	node_140:
+		if(*(cache_0 + pixel[5]) > cb)
+			goto node_139;
+		goto structured;
+	node_148:
+		if(*(cache_1+-1) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		goto node_144;
+	node_157:
+		if(*(cache_1+-1) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		if(*(cache_1+1) >= c_b)
+			goto node_151;
+		if(*(cache_2+-3) >= c_b)
+			goto node_152;
+		goto success;
+	node_185:
+		if(*(cache_1+-1) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		if(*(cache_1+1) >= c_b)
+			goto node_171;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto node_174;
+		if(*(cache_1+2) >= c_b)
+			goto node_177;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto node_152;
+		goto node_179;
+	node_174:
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		goto node_173;
+	node_224:
+		if(*(cache_1+-1) >= c_b)
+			goto structured;
+		if(*(cache_1+1) >= c_b)
+			goto node_204;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto node_207;
+		if(*(cache_1+2) >= c_b)
+			goto node_209;
+		if(*(cache_0+-3) >= c_b)
+			goto node_211;
+		goto node_219;
+	node_207:
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		goto node_206;
+	node_444:
+		if(*cache_1 > cb)
+			goto node_367;
+		if(*cache_1 < c_b)
+			goto node_434;
+		if(*(cache_2+-2) > cb)
+			goto structured;
+		if(*(cache_2+-2) < c_b)
+			goto node_442;
+		goto homogeneous;
+	node_442:
+		if(*(cache_2+-1) > cb)
+			goto structured;
+		if(*(cache_2+-1) < c_b)
+			goto node_441;
+		goto homogeneous;
+	node_441:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_436;
+		if(*(cache_0 + pixel[1]) < c_b)
+			goto node_439;
+		if(*(cache_1+-1) > cb)
+			goto structured;
+		if(*(cache_1+-1) < c_b)
+			goto node_435;
+		goto homogeneous;
+	node_435:
+		if(*(cache_0 + pixel[10]) >= c_b)
+			goto structured;
+	node_342:
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		goto node_341;
+	node_436:
+		if(*(cache_1+-1) >= c_b)
+			goto structured;
+		goto node_435;
+	node_439:
+		if(*(cache_2+-3) >= c_b)
+			goto node_345;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto node_437;
+	node_354:
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto node_206;
+		if(*(cache_0+3) >= c_b)
+			goto node_349;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto node_210;
+		goto node_351;
+	node_437:
+		if(*(cache_0 + pixel[10]) >= c_b)
+			goto structured;
+		goto node_347;
+	node_367:
+		if(*(cache_0 + pixel[10]) > cb)
+			goto node_340;
+		if(*(cache_0 + pixel[10]) < c_b)
+			goto node_359;
+		if(*(cache_0 + pixel[1]) > cb)
+			goto structured;
+		if(*(cache_0 + pixel[1]) < c_b)
+			goto node_365;
+		goto homogeneous;
+	node_365:
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto node_342;
+		if(*(cache_2+-3) >= c_b)
+			goto node_317;
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto node_346;
+		goto node_321;
+	node_340:
+		if(*(cache_0 + pixel[2]) > cb)
+			goto node_266;
+		if(*(cache_0 + pixel[2]) < c_b)
+			goto node_336;
+		if(*(cache_1+-1) > cb)
+			goto node_338;
+		goto structured;
+	node_338:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_337;
+		goto structured;
+	node_337:
+		if(*(cache_0+-3) > cb)
+			goto node_93;
+		goto structured;
+	node_266:
+		if(*(cache_1+-1) > cb)
+			goto node_265;
+		goto structured;
+	node_265:
+		if(*(cache_1+1) > cb)
+			goto node_262;
+		goto node_264;
+	node_262:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_260;
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_91;
+		goto structured;
+	node_260:
+		if(*(cache_1+2) > cb)
+			goto node_257;
+		goto node_259;
+	node_257:
+		if(*(cache_0+-3) > cb)
+			goto node_255;
+		goto node_256;
+	node_336:
+		if(*(cache_0+-3) > cb)
+			goto node_314;
+		if(*(cache_0+-3) < c_b)
+			goto node_327;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto node_213;
+		if(*(cache_2+-3) >= c_b)
+			goto node_297;
+		goto node_328;
+	node_314:
+		if(*(cache_0 + pixel[4]) > cb)
+			goto node_273;
+		if(*(cache_0 + pixel[4]) < c_b)
+			goto node_309;
+		if(*(cache_1+-1) > cb)
+			goto node_312;
+		goto structured;
+	node_312:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_311;
+		goto structured;
+	node_311:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_310;
+		goto structured;
+	node_310:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_71;
+		goto structured;
+	node_273:
+		if(*(cache_1+-1) > cb)
+			goto node_272;
+		goto structured;
+	node_272:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_271;
+		goto structured;
+	node_271:
+		if(*(cache_1+1) > cb)
+			goto node_270;
+		goto node_76;
+	node_270:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_268;
+		goto node_269;
+	node_268:
+		if(*(cache_1+2) > cb)
+			goto node_267;
+		goto node_88;
+	node_267:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_83;
+		goto node_84;
+	node_309:
+		if(*(cache_0 + pixel[14]) > cb)
+			goto node_294;
+		if(*(cache_0 + pixel[14]) < c_b)
+			goto node_303;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+		if(*(cache_1+2) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+	node_284:
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		goto node_283;
+	node_294:
+		if(*(cache_1+2) > cb)
+			goto node_278;
+		if(*(cache_1+2) < c_b)
+			goto node_288;
+		if(*(cache_1+-1) > cb)
+			goto node_292;
+		goto structured;
+	node_292:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_291;
+		goto structured;
+	node_291:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_290;
+		goto structured;
+	node_290:
+		if(*(cache_2+-3) > cb)
+			goto node_289;
+		goto structured;
+	node_289:
+		if(*(cache_2+-2) > cb)
+			goto node_51;
+		goto structured;
+	node_278:
+		if(*(cache_1+-1) > cb)
+			goto node_277;
+		goto structured;
+	node_277:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_276;
+		goto structured;
+	node_276:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_275;
+		goto structured;
+	node_275:
+		if(*(cache_1+1) > cb)
+			goto node_274;
+		goto node_6;
+	node_274:
+		if(*(cache_2+-3) > cb)
+			goto success;
+		goto node_84;
+	node_288:
+		if(*(cache_2+-2) > cb)
+			goto node_282;
+		if(*(cache_2+-2) < c_b)
+			goto node_287;
+		goto structured;
+	node_282:
+		if(*(cache_1+-1) > cb)
+			goto node_281;
+		goto structured;
+	node_281:
+		if(*(cache_0 + pixel[11]) > cb)
+			goto node_280;
+		goto structured;
+	node_280:
+		if(*(cache_0 + pixel[13]) > cb)
+			goto node_279;
+		goto structured;
+	node_279:
+		if(*(cache_2+-3) > cb)
+			goto node_51;
+		goto structured;
+	node_287:
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+		goto node_284;
+	node_303:
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto node_295;
+		if(*(cache_2+-3) >= c_b)
+			goto node_297;
+		goto success;
+	node_327:
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_0+3) >= c_b)
+			goto node_315;
+		if(*(cache_2+-3) >= c_b)
+			goto node_317;
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto node_318;
+		goto node_321;
+	node_315:
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		goto node_213;
+	node_359:
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_2+-1) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[1]) >= c_b)
+			goto node_343;
+		if(*(cache_2+-3) >= c_b)
+			goto node_345;
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto node_347;
+		goto node_354;
+	node_343:
+		if(*(cache_1+-1) >= c_b)
+			goto structured;
+		goto node_342;
+	node_434:
+		if(*(cache_0 + pixel[1]) > cb)
+			goto node_371;
+		if(*(cache_0 + pixel[1]) < c_b)
+			goto node_432;
+		if(*(cache_1+-1) > cb)
+			goto structured;
+		if(*(cache_1+-1) < c_b)
+			goto node_370;
+		goto homogeneous;
+	node_370:
+		if(*(cache_0 + pixel[10]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		if(*(cache_0+-3) >= c_b)
+			goto node_345;
+		goto node_228;
+	node_371:
+		if(*(cache_1+-1) >= c_b)
+			goto structured;
+		goto node_370;
+	node_432:
+		if(*(cache_0 + pixel[2]) >= c_b)
+			goto node_377;
+		if(*(cache_0+3) >= c_b)
+			goto node_390;
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto node_404;
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto node_416;
+		if(*(cache_1+2) >= c_b)
+			goto node_425;
+		if(*(cache_1+1) >= c_b)
+			goto node_151;
+		if(*(cache_1+-1) >= c_b)
+			goto node_143;
+		goto success;
+	node_425:
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_2+-2) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto node_143;
+		if(*(cache_2+-1) >= c_b)
+			goto node_420;
+		goto success;
+	node_420:
+		if(*(cache_1+1) >= c_b)
+			goto structured;
+		if(*(cache_1+-1) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[10]) >= c_b)
+			goto structured;
+		goto node_417;
+	node_416:
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_2+-3) >= c_b)
+			goto structured;
+		if(*(cache_0+-3) >= c_b)
+			goto node_150;
+		if(*(cache_2+-2) >= c_b)
+			goto node_409;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto node_143;
+		if(*(cache_2+-1) >= c_b)
+			goto node_393;
+		goto success;
+	node_393:
+		if(*(cache_1+1) >= c_b)
+			goto structured;
+		if(*(cache_1+-1) >= c_b)
+			goto structured;
+		goto node_391;
+	node_409:
+		if(*(cache_1+2) >= c_b)
+			goto structured;
+		if(*(cache_1+1) >= c_b)
+			goto structured;
+		if(*(cache_1+-1) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[10]) >= c_b)
+			goto structured;
+		goto node_405;
+	node_404:
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto node_151;
+		if(*(cache_2+-3) >= c_b)
+			goto node_395;
+		if(*(cache_0 + pixel[10]) >= c_b)
+			goto node_150;
+		if(*(cache_2+-2) >= c_b)
+			goto node_380;
+		if(*(cache_1+-1) >= c_b)
+			goto node_143;
+		goto node_396;
+	node_380:
+		if(*(cache_1+2) >= c_b)
+			goto structured;
+		if(*(cache_1+1) >= c_b)
+			goto structured;
+		if(*(cache_1+-1) >= c_b)
+			goto structured;
+		goto success;
+	node_395:
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+		if(*(cache_1+2) >= c_b)
+			goto structured;
+		goto node_393;
+	node_390:
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[10]) >= c_b)
+			goto node_170;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto node_382;
+		if(*(cache_1+-1) >= c_b)
+			goto node_151;
+		if(*(cache_2+-3) >= c_b)
+			goto node_316;
+		if(*(cache_2+-2) >= c_b)
+			goto node_297;
+		goto node_144;
+	node_382:
+		if(*(cache_0 + pixel[4]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[5]) >= c_b)
+			goto structured;
+		goto node_380;
+	node_377:
+		if(*(cache_0 + pixel[10]) >= c_b)
+			goto structured;
+		if(*(cache_0 + pixel[11]) >= c_b)
+			goto structured;
+		if(*(cache_0+-3) >= c_b)
+			goto structured;
+		if(*(cache_1+-1) >= c_b)
+			goto node_171;
+		if(*(cache_0 + pixel[13]) >= c_b)
+			goto node_344;
+		if(*(cache_0 + pixel[14]) >= c_b)
+			goto node_317;
+		goto node_188;
+}
+
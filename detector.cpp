@@ -40,18 +40,19 @@
 	Questions per pixel: 2.63777
 */
 
-#include "detector.h"																			
-xy* sfast_corner_detect(const byte* im, const byte* mask, int xsize, int xstride, int ysize, int barrier, int* num)	
-{																								
-	int boundary = 18, y, cb, c_b;																
-	const byte  *line_max, *line_min;															
-	int			rsize=512, total=0;																
-	xy	 		*ret = (xy*)malloc(rsize*sizeof(xy));											
-	const byte  *pMask;											
+#include "detector.h"
+
+// detect the corners on the run [xbegin, xend) of row y, writing their x coordinates to xs
+int sfast_corner_detect_span(const byte* im, int xstride, int y, int xbegin, int xend, int barrier, int* xs)
+{
+	int cb, c_b;
+	const byte  *line_max, *line_min;
+	int			total=0;
 	const byte* cache_0;
 	const byte* cache_1;
 	const byte* cache_2;
-	int	pixel[18];																				
+	int	pixel[18];
+
 	pixel[0] = 0 + 3 * xstride;		
 	pixel[1] = 1 + 2 * xstride;		
 	pixel[2] = 2 + 1 * xstride;		
@@ -70,22 +71,17 @@ xy* sfast_corner_detect(const byte* im, const byte* mask, int xsize, int xstride
 	pixel[15] = -3 + 3 * xstride;		
 	pixel[16] = -2 + 3 * xstride;		
 	pixel[17] = -1 + 3 * xstride;		
-	for(y = boundary ; y < ysize - boundary; y++)												
-	{																							
-		cache_0 = im + boundary + y*xstride;													
-		pMask = mask + boundary + y*xstride;													
-		line_min = cache_0 - boundary;															
-		line_max = im + xsize - boundary + y * xstride;											
-																								
-		cache_1 = cache_0 + pixel[14];
-		cache_2 = cache_0 + pixel[5];
-																								
-		for(; cache_0 < line_max;pMask++, cache_0++, cache_1++, cache_2++)
-		{																						
-			if(*pMask==0)																		
-				continue;																		
-			cb = *cache_0 + barrier;															
-			c_b = *cache_0 - barrier;															
+	line_min = im + y*xstride;
+	line_max = line_min + xend;
+	cache_0 = line_min + xbegin;
+
+	cache_1 = cache_0 + pixel[14];
+	cache_2 = cache_0 + pixel[5];
+
+	for(; cache_0 < line_max; cache_0++, cache_1++, cache_2++)
+	{
+		cb = *cache_0 + barrier;
+		c_b = *cache_0 - barrier;
             if(*cache_1 > cb)
                 if(*(cache_0 + pixel[2]) > cb)
                     if(*(cache_0 + pixel[17]) > cb)
@@ -8354,25 +8350,12 @@ xy* sfast_corner_detect(const byte* im, const byte* mask, int xsize, int xstride
                             continue;
                 else
                     continue;
-			success:																			
-				if(total >= rsize)																
-				{																				
-					rsize *=2;																	
-					ret=(xy*)realloc(ret, rsize*sizeof(xy));									
-					if(ret == NULL)																
-					{																			
-						*num=-1;																
-						return NULL;															
-					}																			
-				}																				
-				ret[total].x = cache_0-line_min;												
-				ret[total++].y = y;																
-		}																						
-	}																							
-	*num = total;																				
-	return ret;																					
-}																								
-																								
+            success:
+                xs[total++] = (int)(cache_0-line_min);
+	}
+	return total;
+}
+
 int sfast_corner_score(const byte* im, const int pixel[], int bstart)                        	
 {                                                                                              
 	int bmin = bstart;                                                                          
@@ -31,29 +31,147 @@ using namespace cv;
 
 namespace cv
 {
+	// The features of an image as a structure of arrays, the i-th entry of every array
+	// and the i-th row of the descriptors belonging to the same feature. The points are
+	// on the spherical image of level 0 as those of the keypoints, the rows of the
+	// descriptors are aligned on 16 bytes.
+	struct CV_EXPORTS SphericalFeatures
+	{
+		vector<Point3f> bearings;
+		vector<Point2f> points;
+		vector<float> responses;
+		// the orientations as the moment vectors (m_10, m_01), the angles being
+		// computed only for the keypoints asked for
+		vector<Point2f> moments;
+		vector<int> levels;
+		Mat descriptors;
+
+		size_t size() const;
+		void clear();
+
+		// append the keypoints of a level and their moment vectors, except their bearings
+		void append(const vector<KeyPoint>& kps, const vector<Point2f>& levelMoments);
+
+		// the angle of the i-th feature in degrees, as in its keypoint
+		float angle(size_t i) const;
+
+		// the i-th feature as the keypoint operator() returns for it
+		KeyPoint keyPoint(size_t i) const;
+		void toKeyPoints(vector<KeyPoint>& keypoints) const;
+	};
+
 	class CV_EXPORTS SPHORB : public cv::Feature2D
 	{
 	public:
-		enum { kBytes = 32, SFAST_EDGE = 3, SPHORB_EDGE = 15};
+		enum { kBytes = 32, kMaxBytes = 32, SFAST_EDGE = 3, SPHORB_EDGE = 15};
+
+		// the optional behaviours selected by the flags of the constructor
+		enum
+		{
+			// adapt the detection threshold of every level from frame to frame,
+			// so that it yields a number of corners proportional to the level budget;
+			// with COARSE_TO_FINE only the coarsest level, searched whole, adapts
+			ADAPTIVE_THRESHOLD = 1,
+			// select the features of every level per equal-area cell of the sphere
+			// rather than globally, so that they spread evenly over the sphere
+			SPHERE_BUCKETING = 2,
+			// detect the corners with the adaptive segment test (AGAST), which
+			// switches between trees of homogeneous and structured regions learned on
+			// random ring configurations; its trees decide the segment test exactly,
+			// whereas the learned tree of the default detector misclassifies some
+			// configurations, so it finds a different set of corners; it is not faster
+			AGAST_DETECTOR = 4,
+			// skip the blocks whose contrast is too low for any corner
+			BLOCK_SKIPPING = 8,
+			// detect from the coarsest level, searching the finer levels only around
+			// the features of the coarser one and in a few exploratory blocks;
+			// the features are then returned from the coarsest level
+			COARSE_TO_FINE = 16,
+			// describe the features by comparing box sums around the points of the
+			// pattern, read from integral images, instead of smoothing the parts
+			BOX_DESCRIPTOR = 32
+		};
+
+		// the sampling schemes of the descriptors
+		enum
+		{
+			// never produced by this build, it only tags the descriptors saved by earlier
+			// builds, which steered the pattern exactly along the orientation of the feature
+			// as the original SPHORB; they do not match those of the other schemes
+			DESCRIPTOR_STEERED_POINTS = 1,
+			// the points of the smoothed parts, with the pattern rotated by bins of 12 degrees
+			DESCRIPTOR_POINTS = 2,
+			// the box sums of BOX_DESCRIPTOR, with the pattern rotated by bins of 12 degrees
+			DESCRIPTOR_BOXES = 3
+		};
 
-		explicit SPHORB(int nfeatures = 500, int nlevels = 7, int b=20);
+		// the descriptors have 16 or 32 bytes, the 16-byte one of a feature being the
+		// first half of its 32-byte one
+		explicit SPHORB(int nfeatures = 500, int nlevels = 7, int b=20, int flags=0, int bytes=kBytes);
+		// a copy has the configuration and state of the original but its own workspace
+		SPHORB(const SPHORB& other);
+		SPHORB& operator=(const SPHORB& other);
 		~SPHORB();
 
 		// returns the descriptor size in bytes
 		int descriptorSize() const;
 		// returns the descriptor type
 		int descriptorType() const;
+		// returns the version of the descriptors, the sampling scheme in the high byte and
+		// the revision of the sampling pattern in the low byte; only descriptors of the
+		// same version match
+		int descriptorVersion() const;
+		// the sampling scheme and the pattern revision of a version
+		static int descriptorScheme(int version) { return version >> 8; }
+		static int patternRevision(int version) { return version & 255; }
 
-		// Compute the ORB features and descriptors on an image
+		// Compute the ORB features and descriptors on an image. The descriptors are written
+		// into the given matrix when it owns its buffer alone, which keeps its capacity from
+		// one image to the next; a matrix sharing its buffer, as after prev = desc, is given
+		// a new one and the other matrix is left untouched. A submatrix or a matrix on
+		// external data, such as a slot of a ring of buffers, is written in place without
+		// reallocation and its rows cut to the features; it must be CV_8UC1 with
+		// descriptorSize() columns and enough rows for the features, or an error is raised.
+		// There are at most nfeatures of them, so a slot of nfeatures rows is always enough.
 		void operator()(InputArray image, InputArray mask, vector<KeyPoint>& keypoints) const;
 		void operator()( InputArray image, InputArray mask, vector<KeyPoint>& keypoints,
                      OutputArray descriptors, bool useProvidedKeypoints=false ) const;
+		// Also return the bearing of every feature, the unit vector of its direction on the
+		// sphere, and its position on the input image. The keypoints are on the spherical
+		// image of level 0, of 1280x640 pixels, a keypoint (u, v) having the bearing
+		// (sin t cos p, sin t sin p, cos t) with t = v*pi/640 and p = u*pi/640 - pi
+		void operator()( InputArray image, InputArray mask, vector<KeyPoint>& keypoints, OutputArray descriptors,
+		                 vector<Point3f>& bearings, vector<Point2f>& imagePoints ) const;
+		// Compute the features and descriptors as arrays
+		void operator()( InputArray image, InputArray mask, SphericalFeatures& features ) const;
+
+		// Split a spherical image to the five extended parts of the storage grid of a level,
+		// mask receives the pixels of every part the detector runs on
+		void storageGrid(InputArray image, int level, vector<Mat>& parts, Mat& mask) const;
+		// Smooth a part of the storage grid as it is before description
+		void smoothPart(const Mat& part, Mat& smoothed) const;
 
 	protected:
 		int barrier;
 		int nfeatures;
 		int nlevels;
+		int flags;
+		int bytes;
+
+		// the current threshold of every level in the adaptive mode
+		mutable vector<int> levelBarriers;
+		// the number of frames processed, which shifts the exploratory blocks
+		mutable int frameCount;
+
+		// The scratch memory of the extraction, kept from frame to frame so that the
+		// frames after the first one do not allocate. An extractor is thus used by one
+		// thread at a time; the threads should have an extractor each.
+		struct Workspace;
+		Workspace* workspace;
 
+		void detectAndCompute( InputArray image, InputArray mask, vector<KeyPoint>& keypoints, OutputArray descriptors,
+		                       bool useProvidedKeypoints, vector<Point3f>* bearings, vector<Point2f>* imagePoints,
+		                       SphericalFeatures* features ) const;
 		void computeImpl( const Mat& image, vector<KeyPoint>& keypoints, Mat& descriptors ) const;
 		void detectImpl( const Mat& image, vector<KeyPoint>& keypoints, const Mat& mask=Mat() ) const;
 	};
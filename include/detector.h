@@ -26,19 +26,135 @@
 
 #include <opencv2/opencv.hpp>
 #include <vector>
+#include <algorithm>
 
 using namespace std;
 using namespace cv;
 
-typedef CvPoint xy;																			
 typedef unsigned char byte;																	
 
-xy* sfast_corner_detect(const byte* im, const byte* mask, int xsize, int xstride, int ysize, int barrier, int* num);
+// the mask of a storage grid encoded as runs of valid pixels,
+// the runs [begin, end) of row y are spans[rowStart[y]] ... spans[rowStart[y+1]-1]
+struct MaskSpans
+{
+	int cols, rows;
+	vector<int> rowStart;
+	vector<Vec2i> spans;
+};
+
+void buildMaskSpans(const Mat& mask, int boundary, MaskSpans& maskSpans);
+
+// the square blocks of a part, the pixels of the inactive blocks are not tested
+struct BlockMask
+{
+	int size, cols, rows;
+	vector<uchar> active;
+};
+
+// the ranges of the blocks of buildContrastMask and the extents of the rows of the mask,
+// which can be reused from call to call
+struct ContrastBuffer
+{
+	vector<uchar> minVal;
+	vector<uchar> maxVal;
+	vector<uchar> minLanes;
+	vector<uchar> maxLanes;
+	vector<int> first;
+	vector<int> last;
+};
+
+// Mark the blocks which may hold a corner. A corner needs ring pixels differing
+// from the centre by more than the barrier, so a block is inactive when the range
+// of the pixels within the ring radius of the block is at most the barrier. Only
+// the pixels within the ring radius of the runs of the mask are taken into account.
+void buildContrastMask(const byte* im, int xstride, const MaskSpans& mask, int b, int blockSize, BlockMask& blocks,
+					   ContrastBuffer* buffer = NULL);
+
+struct ResponseGreater
+{
+	bool operator()(const KeyPoint& kp1, const KeyPoint& kp2) const
+	{
+		return kp1.response > kp2.response;
+	}
+};
+
+// Keep the n strongest key points, exactly n of them even when more share the
+// response of the n-th, unlike KeyPointsFilter::retainBest which keeps the ties.
+inline void retainStrongest(vector<KeyPoint>& kps, int n)
+{
+	n = std::max(n, 0);
+	if ((int)kps.size() <= n)
+		return;
+	std::nth_element(kps.begin(), kps.begin() + n, kps.end(), ResponseGreater());
+	kps.resize(n);
+}
+
+// The strongest key points pushed so far, kept in a min-heap of fixed capacity
+// so that memory and selection time are bounded by the capacity. A negative
+// capacity keeps every key point.
+class KeyPointHeap
+{
+public:
+	KeyPointHeap() : capacity(-1), total(0) {}
+
+	void reset(int _capacity)
+	{
+		capacity = _capacity;
+		total = 0;
+		kps.clear();
+		if (capacity > 0)
+			kps.reserve(capacity);
+	}
+
+	void push(const KeyPoint& kp)
+	{
+		total++;
+		if (capacity < 0)
+			kps.push_back(kp);
+		else if ((int)kps.size() < capacity)
+		{
+			kps.push_back(kp);
+			std::push_heap(kps.begin(), kps.end(), ResponseGreater());
+		}
+		else if (capacity > 0 && kp.response > kps.front().response)
+		{
+			std::pop_heap(kps.begin(), kps.end(), ResponseGreater());
+			kps.back() = kp;
+			std::push_heap(kps.begin(), kps.end(), ResponseGreater());
+		}
+	}
+
+	// the number of key points pushed since the last reset
+	int pushed() const { return total; }
+
+	vector<KeyPoint>& keypoints() { return kps; }
+
+private:
+	int capacity;
+	int total;
+	vector<KeyPoint> kps;
+};
+
+// the segment test on a run of pixels of a row
+typedef int (*CornerDetectSpan)(const byte* im, int xstride, int y, int xbegin, int xend, int barrier, int* xs);
+
+int sfast_corner_detect_span(const byte* im, int xstride, int y, int xbegin, int xend, int barrier, int* xs);
 
 int sfast_corner_score(const byte* im, const int pixel[], int bstart);
 
-int* sfastScore(const unsigned char* i, int stride, xy* corners, int num_corners, int b);
+// the same segment test, switching between the trees of homogeneous and structured regions
+int agast_corner_detect_span(const byte* im, int xstride, int y, int xbegin, int xend, int barrier, int* xs);
+
+// the rows of corners and scores of sfastDetectNonmax, which can be reused from
+// call to call; the scores are all -1 between the calls
+struct NonmaxBuffer
+{
+	vector<int> xs;
+	vector<int> scores;
+};
 
-void sfastNonmaxSuppression(const xy* corners, const int* scores, int num_corners, vector<KeyPoint>& kps, int partIndex);
+void sfastDetectNonmax(const byte* im, int xstride, const MaskSpans& mask, int b, KeyPointHeap& kps, int partIndex,
+					   CornerDetectSpan detect = sfast_corner_detect_span, const BlockMask* blocks = NULL,
+					   NonmaxBuffer* buffer = NULL);
 
 #endif
\ No newline at end of file
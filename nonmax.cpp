@@ -47,133 +47,341 @@ static void makeOffsets(int pixel[], int xstride)
 	pixel[17] = -1 + 3 * xstride;
 }
 
-int* sfastScore(const unsigned char* i, int stride, xy* corners, int num_corners, int b)
-{	
-	int* scores = (int*)malloc(sizeof(int)* num_corners);
-
-	int pixel[18];
-	makeOffsets(pixel, stride);
+// Encode the non-zero pixels of the mask as runs on every row,
+// leaving out the boundary pixels which are never tested by the detector.
+void buildMaskSpans(const Mat& mask, int boundary, MaskSpans& maskSpans)
+{
+	maskSpans.cols = mask.cols;
+	maskSpans.rows = mask.rows;
+	maskSpans.rowStart.assign(mask.rows+1, 0);
+	maskSpans.spans.clear();
 
-	for(int n=0; n < num_corners; n++)
-		scores[n] = sfast_corner_score(i + corners[n].y*stride + corners[n].x, pixel, b);
+	for(int y=0; y<mask.rows; y++)
+	{
+		maskSpans.rowStart[y] = (int)maskSpans.spans.size();
+		if(y < boundary || y >= mask.rows - boundary)
+			continue;
 
-	return scores;
+		const uchar* pMask = mask.ptr<uchar>(y);
+		int x = boundary;
+		while(x < mask.cols - boundary)
+		{
+			for(; x < mask.cols - boundary && pMask[x]==0; x++)
+			{}
+			int begin = x;
+			for(; x < mask.cols - boundary && pMask[x]!=0; x++)
+			{}
+			if(x > begin)
+				maskSpans.spans.push_back(Vec2i(begin, x));
+		}
+	}
+	maskSpans.rowStart[mask.rows] = (int)maskSpans.spans.size();
 }
 
-void sfastNonmaxSuppression(const xy* corners, const int* scores, int num_corners, vector<KeyPoint>& kps, int partIndex)
+// the ranges of the blocks of a row over the pixels [x0, x1)
+static void scanRanges(const byte* p, int x0, int x1, int blockSize, uchar* pMin, uchar* pMax)
 {
-	bool goto_enabled = false;
-	int num_nonmax=0;
-	int last_row;
-	int* row_start;
-	int i, j;
-	const int sz = (int)num_corners; 
-	kps.clear();
-
-	/*Point above points (roughly) to the pixel above the one of interest, if there
-    is a feature there.*/
-	int point_above = 0;
-	int point_below = 0;
-
-	
-	if(num_corners < 1)
-		return;
-
-	/* Find where each row begins
-	   (the corners are output in raster scan order). A beginning of -1 signifies
-	   that there are no corners on that row. */
-	last_row = corners[num_corners-1].y;
-	row_start = (int*)malloc((last_row+1)*sizeof(int));
-
-	for(i=0; i < last_row+1; i++)
-		row_start[i] = -1;
-	
-	int prev_row = -1;
-	for(i=0; i< num_corners; i++)
+	for(int bx=x0/blockSize; bx*blockSize<x1; bx++)
 	{
-		if(corners[i].y != prev_row)
+		int end = std::min(x1, (bx+1)*blockSize);
+		uchar mn = pMin[bx], mx = pMax[bx];
+		for(int x=std::max(x0, bx*blockSize); x<end; x++)
 		{
-			row_start[corners[i].y] = i;
-			prev_row = corners[i].y;
+			mn = std::min(mn, p[x]);
+			mx = std::max(mx, p[x]);
 		}
+		pMin[bx] = mn;
+		pMax[bx] = mx;
+	}
+}
+
+#if CV_SSE2
+// the minimum and maximum of the 16 lanes of a vector
+static inline uchar minLane(__m128i v)
+{
+	v = _mm_min_epu8(v, _mm_srli_si128(v, 8));
+	v = _mm_min_epu8(v, _mm_srli_si128(v, 4));
+	v = _mm_min_epu8(v, _mm_srli_si128(v, 2));
+	v = _mm_min_epu8(v, _mm_srli_si128(v, 1));
+	return (uchar)_mm_cvtsi128_si32(v);
+}
+
+static inline uchar maxLane(__m128i v)
+{
+	v = _mm_max_epu8(v, _mm_srli_si128(v, 8));
+	v = _mm_max_epu8(v, _mm_srli_si128(v, 4));
+	v = _mm_max_epu8(v, _mm_srli_si128(v, 2));
+	v = _mm_max_epu8(v, _mm_srli_si128(v, 1));
+	return (uchar)_mm_cvtsi128_si32(v);
+}
+#endif
+
+// The block size must exceed the ring radius, so that the pixels within the ring
+// radius of a block lie in the block and its eight neighbours. Only the pixels the
+// segment test reads are scanned, those within the ring radius of the runs of the
+// mask; with blocks of 16 pixels, the blocks a row covers whole are scanned as
+// vectors, accumulated lane by lane over the rows of the block.
+void buildContrastMask(const byte* im, int xstride, const MaskSpans& mask, int b, int blockSize, BlockMask& blocks,
+					   ContrastBuffer* buffer)
+{
+	const int radius = 3;
+	CV_Assert(blockSize > radius);
+	int xsize = mask.cols;
+	int ysize = mask.rows;
+	int cols = (xsize + blockSize - 1)/blockSize;
+	int rows = (ysize + blockSize - 1)/blockSize;
+	int x, y, bx, by;
+
+	ContrastBuffer localBuffer;
+	ContrastBuffer& ranges = buffer ? *buffer : localBuffer;
+
+	// the extent of the runs of every row
+	vector<int>& first = ranges.first;
+	vector<int>& last = ranges.last;
+	first.assign(ysize, xsize);
+	last.assign(ysize, 0);
+	for(y=0; y<ysize; y++)
+	{
+		if(mask.rowStart[y] == mask.rowStart[y+1])
+			continue;
+		first[y] = mask.spans[mask.rowStart[y]][0];
+		last[y] = mask.spans[mask.rowStart[y+1]-1][1];
+	}
+
+	// the range of every block
+	vector<uchar>& minVal = ranges.minVal;
+	vector<uchar>& maxVal = ranges.maxVal;
+	minVal.assign(cols*rows, 255);
+	maxVal.assign(cols*rows, 0);
+#if CV_SSE2
+	bool lanes = blockSize == 16;
+	if(lanes)
+	{
+		ranges.minLanes.resize(cols*16);
+		ranges.maxLanes.resize(cols*16);
 	}
-	
-	
-	
-	for(i=0; i < sz; i++)
+#endif
+	for(by=0; by<rows; by++)
 	{
-		int score = scores[i];
-		xy pos = corners[i];
-			
-		/*Check left */
-		if(i > 0)
-			if(corners[i-1].x == pos.x-1 && corners[i-1].y == pos.y && Compare(scores[i-1], score))
+		uchar* pMin = &minVal[by*cols];
+		uchar* pMax = &maxVal[by*cols];
+		int y1 = std::min((by+1)*blockSize, ysize);
+#if CV_SSE2
+		if(lanes)
+		{
+			memset(&ranges.minLanes[0], 255, cols*16);
+			memset(&ranges.maxLanes[0], 0, cols*16);
+		}
+#endif
+		for(y=by*blockSize; y<y1; y++)
+		{
+			int x0 = xsize, x1 = 0;
+			for(int v=std::max(y-radius, 0); v<=std::min(y+radius, ysize-1); v++)
+			{
+				x0 = std::min(x0, first[v]);
+				x1 = std::max(x1, last[v]);
+			}
+			if(x0 >= x1)
 				continue;
-			
-		/*Check right*/
-		if(i < (sz - 1))
-			if(corners[i+1].x == pos.x+1 && corners[i+1].y == pos.y && Compare(scores[i+1], score))
+			x0 = std::max(x0-radius, 0);
+			x1 = std::min(x1+radius, xsize);
+
+			const byte* p = im + y*xstride;
+#if CV_SSE2
+			int bx0 = (x0+15)/16, bx1 = x1/16;
+			if(lanes && bx0 < bx1)
+			{
+				scanRanges(p, x0, bx0*16, blockSize, pMin, pMax);
+				for(bx=bx0; bx<bx1; bx++)
+				{
+					__m128i v = _mm_loadu_si128((const __m128i*)(p + bx*16));
+					__m128i* mn = (__m128i*)&ranges.minLanes[bx*16];
+					__m128i* mx = (__m128i*)&ranges.maxLanes[bx*16];
+					_mm_storeu_si128(mn, _mm_min_epu8(_mm_loadu_si128(mn), v));
+					_mm_storeu_si128(mx, _mm_max_epu8(_mm_loadu_si128(mx), v));
+				}
+				scanRanges(p, bx1*16, x1, blockSize, pMin, pMax);
 				continue;
-			
-		/*Check above (if there is a valid row above)*/
-		if(pos.y != 0 && row_start[pos.y - 1] != -1) 
+			}
+#endif
+			scanRanges(p, x0, x1, blockSize, pMin, pMax);
+		}
+#if CV_SSE2
+		if(lanes)
 		{
-			/*Make sure that current point_above is one
-			  row above.*/
-			if(corners[point_above].y < pos.y - 1)
-				point_above = row_start[pos.y-1];
-			
-			/*Make point_above point to the first of the pixels above the current point,
-			  if it exists.*/
-			for(; corners[point_above].y < pos.y && corners[point_above].x < pos.x; point_above++)
-			{}
-			
-			
-			for(j=point_above; corners[j].y < pos.y && corners[j].x <= pos.x + 1; j++)
+			for(bx=0; bx<cols; bx++)
+			{
+				pMin[bx] = std::min(pMin[bx], minLane(_mm_loadu_si128((const __m128i*)&ranges.minLanes[bx*16])));
+				pMax[bx] = std::max(pMax[bx], maxLane(_mm_loadu_si128((const __m128i*)&ranges.maxLanes[bx*16])));
+			}
+		}
+#endif
+	}
+
+	// widened to the neighbouring blocks
+	blocks.size = blockSize;
+	blocks.cols = cols;
+	blocks.rows = rows;
+	blocks.active.resize(cols*rows);
+	for(by=0; by<rows; by++)
+	{
+		for(bx=0; bx<cols; bx++)
+		{
+			int mn = 255, mx = 0;
+			for(y=std::max(by-1, 0); y<=std::min(by+1, rows-1); y++)
 			{
-				int x = corners[j].x;
-				if( (x ==pos.x || x == pos.x+1) && Compare(scores[j], score)){
-                    goto_enabled = true;
-					goto cont;
+				for(x=std::max(bx-1, 0); x<=std::min(bx+1, cols-1); x++)
+				{
+					mn = std::min(mn, (int)minVal[y*cols+x]);
+					mx = std::max(mx, (int)maxVal[y*cols+x]);
 				}
 			}
-			
+			blocks.active[by*cols+bx] = mx - mn > b;
 		}
-			
-		/*Check below (if there is anything below)*/
-		if(pos.y != last_row && row_start[pos.y + 1] != -1 && point_below < sz) /*Nothing below*/
+	}
+}
+
+static inline void pushCorner(KeyPointHeap& kps, int x, int row, int score, int partIndex)
+{
+	KeyPoint kp;
+	kp.pt.x = x;
+	kp.pt.y = row;
+	kp.response = score;
+	kp.class_id = partIndex;
+	kps.push(kp);
+}
+
+// Suppress the n corners xs of a row against their six hexagonal neighbours, given
+// the dense scores of the rows above, of the row itself and below. The neighbours
+// of four consecutive pixels are compared at once, which covers the clusters of
+// corners in one step.
+static void suppressRow(const int* xs, int n, const int* above, const int* mid, const int* below,
+						int row, int partIndex, KeyPointHeap& kps)
+{
+	int k = 0;
+
+#if CV_SSE2
+	while(k < n)
+	{
+		int x0 = xs[k] & ~3;
+		__m128i score = _mm_loadu_si128((const __m128i*)(mid + x0));
+		__m128i t = _mm_cmpgt_epi32(score, _mm_loadu_si128((const __m128i*)(mid + x0 - 1)));
+		t = _mm_and_si128(t, _mm_cmpgt_epi32(score, _mm_loadu_si128((const __m128i*)(mid + x0 + 1))));
+		t = _mm_and_si128(t, _mm_cmpgt_epi32(score, _mm_loadu_si128((const __m128i*)(above + x0))));
+		t = _mm_and_si128(t, _mm_cmpgt_epi32(score, _mm_loadu_si128((const __m128i*)(above + x0 + 1))));
+		t = _mm_and_si128(t, _mm_cmpgt_epi32(score, _mm_loadu_si128((const __m128i*)(below + x0 - 1))));
+		t = _mm_and_si128(t, _mm_cmpgt_epi32(score, _mm_loadu_si128((const __m128i*)(below + x0))));
+
+		// one bit every four bytes for the pixels greater than all their neighbours
+		int survivors = _mm_movemask_epi8(t);
+		for(; k < n && xs[k] < x0 + 4; k++)
 		{
-			if(corners[point_below].y < pos.y + 1)
-				point_below = row_start[pos.y+1];
-			
-			/* Make point below point to one of the pixels belowthe current point, if it
-			   exists.*/
-			for(; point_below < sz && corners[point_below].y == pos.y+1 && corners[point_below].x < pos.x - 1; point_below++)
-			{}
+			if(survivors & (1 << 4*(xs[k] - x0)))
+				pushCorner(kps, xs[k], row, mid[xs[k]], partIndex);
+		}
+	}
+#endif
+
+	for(; k<n; k++)
+	{
+		int x = xs[k];
+		int score = mid[x];
 
-			for(j=point_below; j < sz && corners[j].y == pos.y+1 && corners[j].x <= pos.x; j++)
+		if(Compare(mid[x-1], score) || Compare(mid[x+1], score) ||
+		   Compare(above[x], score) || Compare(above[x+1], score) ||
+		   Compare(below[x-1], score) || Compare(below[x], score))
+			continue;
+
+		pushCorner(kps, x, row, score, partIndex);
+	}
+}
+
+// Detect, score and suppress the corners of a part in a single pass over its rows.
+// Only three rows of scores are kept alive: row y is detected and scored while
+// row y-1 is suppressed against its six hexagonal neighbours on rows y-2, y-1 and y.
+// Only the valid runs of the mask are visited, and only within the active blocks
+// if given. The surviving corners are pushed to kps in raster order. The rows are
+// kept in the buffer if given, so that they are allocated once for all the parts.
+void sfastDetectNonmax(const byte* im, int xstride, const MaskSpans& mask, int b, KeyPointHeap& kps, int partIndex,
+					   CornerDetectSpan detect, const BlockMask* blocks, NonmaxBuffer* buffer)
+{
+	const int boundary = 18;
+	int xsize = mask.cols;
+	int first_row = boundary;
+	int last_row = mask.rows - boundary - 1;
+	int y, n, k, s;
+
+	if(last_row < first_row)
+		return;
+
+	int pixel[18];
+	makeOffsets(pixel, xstride);
+
+	// x coordinates of the corners and the dense scores of the three rows,
+	// a score of -1 means there is no corner
+	NonmaxBuffer localBuffer;
+	NonmaxBuffer& rows = buffer ? *buffer : localBuffer;
+	if((int)rows.xs.size() < 3*xsize)
+		rows.xs.resize(3*xsize);
+	if((int)rows.scores.size() < 3*xsize)
+		rows.scores.resize(3*xsize, -1);
+	int* xs = &rows.xs[0];
+	int* scores = &rows.scores[0];
+	int num[3] = {0, 0, 0};
+
+	for(y=first_row; y<=last_row+1; y++)
+	{
+		int cur = y%3;
+		int* cur_xs = &xs[cur*xsize];
+		int* cur_scores = &scores[cur*xsize];
+
+		// forget the row y-3 which shared the buffer
+		for(k=0; k<num[cur]; k++)
+			cur_scores[cur_xs[k]] = -1;
+		num[cur] = 0;
+
+		if(y <= last_row)
+		{
+			n = 0;
+			for(s=mask.rowStart[y]; s<mask.rowStart[y+1]; s++)
 			{
-				int x = corners[j].x;
-				if( (x == pos.x - 1 || x ==pos.x) && Compare(scores[j],score)){
-					goto_enabled = true;
-					goto cont;
+				int begin = mask.spans[s][0], end = mask.spans[s][1];
+				if(!blocks)
+				{
+					n += detect(im, xstride, y, begin, end, b, cur_xs + n);
+					continue;
+				}
+
+				// the runs of active blocks within the span
+				const uchar* active = &blocks->active[(y/blocks->size)*blocks->cols];
+				int bx = begin/blocks->size, last = (end-1)/blocks->size;
+				while(bx <= last)
+				{
+					for(; bx <= last && !active[bx]; bx++)
+					{}
+					int first = bx;
+					for(; bx <= last && active[bx]; bx++)
+					{}
+					if(bx > first)
+						n += detect(im, xstride, y, std::max(begin, first*blocks->size), std::min(end, bx*blocks->size), b, cur_xs + n);
 				}
 			}
+			for(k=0; k<n; k++)
+				cur_scores[cur_xs[k]] = sfast_corner_score(im + y*xstride + cur_xs[k], pixel, b);
+			num[cur] = n;
 		}
-		
-		cont:
-
-		if (!goto_enabled){ // If this part reached by goto
-			KeyPoint kp;
-			kp.pt.x = corners[i].x;
-			kp.pt.y = corners[i].y;
-			kp.response = score;
-			kp.class_id = partIndex;
-			kps.push_back(kp);
-		}
-		goto_enabled = false;
 
+		if(y == first_row)
+			continue;
+
+		// suppress the previous row
+		int row = y-1;
+		suppressRow(&xs[(row%3)*xsize], num[row%3], &scores[((row+2)%3)*xsize], &scores[(row%3)*xsize],
+					&scores[cur*xsize], row, partIndex, kps);
 	}
 
-	free(row_start);
-}
\ No newline at end of file
+	// leave the scores of the buffer to -1 for the next part
+	for(s=0; s<3; s++)
+		for(k=0; k<num[s]; k++)
+			scores[s*xsize + xs[s*xsize + k]] = -1;
+}
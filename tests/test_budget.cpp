@@ -0,0 +1,80 @@
+/*
+	The features of every level are bounded by the budget of the level, even when
+	many of them share the same response.
+*/
+
+#include <iostream>
+#include <vector>
+#include <opencv2/opencv.hpp>
+#include "SPHORB.h"
+#include "detector.h"
+using namespace std;
+using namespace cv;
+
+static int failures = 0;
+
+static void check(bool condition, const char* what)
+{
+	if (!condition)
+	{
+		cout << "FAILED: " << what << endl;
+		failures++;
+	}
+}
+
+// key points with the given responses, in order
+static vector<KeyPoint> keyPoints(const float* responses, int n)
+{
+	vector<KeyPoint> kps;
+	for (int i=0; i<n; i++)
+		kps.push_back(KeyPoint(Point2f((float)i, 0), 7, -1, responses[i]));
+	return kps;
+}
+
+int main()
+{
+	// exactly n key points are kept when the n-th one is tied with the next ones
+	float responses[] = { 3, 1, 2, 2, 1, 2, 1, 1, 2, 3, 1, 2 };
+	vector<KeyPoint> kps = keyPoints(responses, 12);
+	retainStrongest(kps, 4);
+	check(kps.size() == 4, "retainStrongest keeps n key points");
+	int strongest = 0;
+	for (size_t i=0; i<kps.size(); i++)
+		strongest += kps[i].response == 3;
+	check(strongest == 2, "retainStrongest keeps the strongest key points");
+
+	float tied[] = { 5, 5, 5, 5, 5, 5, 5, 5 };
+	kps = keyPoints(tied, 8);
+	retainStrongest(kps, 3);
+	check(kps.size() == 3, "retainStrongest keeps n of equal key points");
+
+	// a checkerboard has many corners of the same response, which fill the budgets
+	// of the levels; the descriptors go into a slot of nfeatures rows of a larger
+	// buffer, which is written in place and must not overflow
+	Mat image(640, 1280, CV_8UC3);
+	for (int y=0; y<image.rows; y++)
+		for (int x=0; x<image.cols; x++)
+			image.at<Vec3b>(y, x) = ((x/16 + y/16) & 1) ? Vec3b(255, 255, 255) : Vec3b(0, 0, 0);
+
+	int nfeatures = 500;
+	SPHORB sorb(nfeatures, 7, 20, SPHORB::SPHERE_BUCKETING);
+	Mat buffer(nfeatures + 100, sorb.descriptorSize(), CV_8UC1);
+	Mat slot = buffer.rowRange(50, 50 + nfeatures);
+	vector<KeyPoint> keypoints;
+	try
+	{
+		sorb(image, Mat(), keypoints, slot);
+		check((int)keypoints.size() <= nfeatures, "the features are bounded by nfeatures");
+		check(slot.rows == (int)keypoints.size(), "the slot is cut to the features");
+		check(slot.data == buffer.ptr(50), "the slot is written in place");
+	}
+	catch (const cv::Exception& e)
+	{
+		check(false, e.what());
+	}
+
+	if (failures)
+		return 1;
+	cout << "passed" << endl;
+	return 0;
+}
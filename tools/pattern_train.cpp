@@ -0,0 +1,393 @@
+/*
+	AUTHOR:
+	Qiang Zhao, email: qiangzhao@tju.edu.cn
+	Copyright (C) 2015 Tianjin University
+	School of Computer Software
+	School of Computer Science and Technology
+
+	LICENSE:
+	SPHORB is distributed under the GNU General Public License.  For information on
+	commercial licensing, please contact the authors at the contact address below.
+
+	REFERENCE:
+	@article{zhao-SPHORB,
+	author   = {Qiang Zhao and Wei Feng and Liang Wan and Jiawan Zhang},
+	title    = {SPHORB: A Fast and Robust Binary Feature on the Sphere},
+	journal  = {International Journal of Computer Vision},
+	year     = {2015},
+	volume   = {113},
+	number   = {2},
+	pages    = {143-159},
+	}
+
+
+	Learning of the sampling pattern of the descriptor (bit_pattern in SPHORB.cpp).
+
+	The features of training panoramas are detected on the storage grids of the first
+	levels, oriented by the intensity centroid of their hexagonal patch, and the
+	candidate tests are evaluated on the smoothed parts with the pattern steered by
+	that orientation, as the descriptor does. A candidate test compares two points of
+	the hexagonal grid within the radius of the patch in the Euclidean space, so that
+	it stays within the extended parts once rotated. Following ORB, the tests are then
+	selected greedily by increasing distance of their mean from 0.5, a test being kept
+	when its correlation with every selected one is below a threshold; the threshold
+	is raised until the bit budget is reached. Any prefix of the selected tests is a
+	pattern of a shorter descriptor.
+
+	Usage:
+	pattern_train [options] panorama1 panorama2 ... > pattern.txt
+
+	Options:
+	-n bits			number of tests to select, 8 per byte of SPHORB::kMaxBytes (256)
+	-c candidates	number of random candidate tests (20000)
+	-k features		maximal number of training features (20000)
+	-f features		maximal number of features per part and level (100)
+	-l levels		number of pyramid levels sampled from every panorama (3)
+	-b barrier		threshold of the detector (20)
+	-t threshold	initial threshold of the correlation (0.2)
+
+	Run it from the root directory, it needs the Data folder.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <set>
+#include <vector>
+#include <algorithm>
+#include "SPHORB.h"
+#include "detector.h"
+
+using namespace std;
+using namespace cv;
+
+// the radius of the hexagonal patch, within which the points of the tests lie
+enum { RADIUS = SPHORB::SPHORB_EDGE };
+
+struct Options
+{
+	int bits;
+	int candidates;
+	int features;
+	int featuresPerPart;
+	int levels;
+	int barrier;
+	double threshold;
+};
+
+// a candidate test, whose answers on the training features are the bits of answers
+struct Test
+{
+	Point p1, p2;
+	int ones;
+	vector<uint64> answers;
+};
+
+static inline int popcount(uint64 v)
+{
+	int n = 0;
+	for (; v; n++)
+		v &= v - 1;
+	return n;
+}
+
+// the points of the hexagonal grid within the radius of the patch in the Euclidean space
+static void patchPoints(vector<Point>& points)
+{
+	for (int y=-RADIUS; y<=RADIUS; y++)
+	{
+		for (int x=-2*RADIUS; x<=2*RADIUS; x++)
+		{
+			double ex = x + y * 0.5, ey = y * sqrt(3.0) * 0.5;
+			if (ex*ex + ey*ey <= RADIUS*RADIUS)
+				points.push_back(Point(x, y));
+		}
+	}
+}
+
+// the candidate tests, at most every ordered pair of distinct points of the patch;
+// returns false when there are fewer of them than tests to select
+static bool randomTests(const Options& opt, vector<Test>& tests)
+{
+	vector<Point> points;
+	patchPoints(points);
+
+	int pairs = (int)points.size() * ((int)points.size() - 1);
+	int candidates = std::min(opt.candidates, pairs);
+	if (candidates < opt.bits)
+	{
+		fprintf(stderr, "only %d candidate tests for %d bits\n", pairs, opt.bits);
+		return false;
+	}
+	if (candidates < opt.candidates)
+		fprintf(stderr, "%d candidate tests, every pair of points of the patch\n", candidates);
+
+	RNG rng(0x12345678);
+	set<pair<int, int> > chosen;
+	while ((int)tests.size() < candidates)
+	{
+		int i = rng.uniform(0, (int)points.size());
+		int j = rng.uniform(0, (int)points.size());
+		if (i == j || !chosen.insert(make_pair(i, j)).second)
+			continue;
+
+		Test t;
+		t.p1 = points[i];
+		t.p2 = points[j];
+		t.ones = 0;
+		t.answers.assign((opt.features + 63) / 64, 0);
+		tests.push_back(t);
+	}
+	return true;
+}
+
+// the orientation of a feature by the intensity centroid of its hexagonal patch
+static float orientation(const Mat& part, Point pt)
+{
+	const uchar* center = &part.at<uchar>(pt.y, pt.x);
+	int step = (int)part.step;
+
+	double m_10 = 0, m_01 = 0;
+	for (int y=-RADIUS; y<=RADIUS; y++)
+	{
+		int xmin = y < 0 ? -y-RADIUS : -RADIUS;
+		int xmax = y < 0 ? RADIUS : RADIUS-y;
+		for (int x=xmin; x<=xmax; x++)
+		{
+			m_10 += (x + y * 0.5) * center[x+y*step];
+			m_01 += (y * sqrt(3.0) * 0.5) * center[x+y*step];
+		}
+	}
+	return (float)atan2(m_01, m_10);
+}
+
+// a point of a test rotated to a bin as the descriptor does: by the rotation of its
+// bin of the first sextant, rounded to the grid, then exactly by the sextants, a
+// rotation by 60 degrees mapping (x, y) to (-y, x+y) on the hexagonal grid
+static Point rotatePoint(Point p, float a, float b, float c, int sextant)
+{
+	int x = cvRound(p.x*b - p.y*c);
+	int y = cvRound(p.y*a + p.x*c);
+	for (int s=0; s<sextant; s++)
+	{
+		int t = x;
+		x = -y;
+		y = t + y;
+	}
+	return Point(x, y);
+}
+
+// the answers of the candidate tests on a feature, steered as the descriptor does by
+// the nearest of the 30 orientations of 12 degrees of its rotated patterns
+static void answerTests(const Mat& smoothed, Point pt, float angle, int feature, vector<Test>& tests)
+{
+	const uchar* center = &smoothed.at<uchar>(pt.y, pt.x);
+	int step = (int)smoothed.step;
+
+	// the nearest bin, split into its sextant and its bin within the sextant
+	int k = cvRound(angle * 30 / (2*CV_PI));
+	k = (k % 30 + 30) % 30;
+	int sextant = k / 5;
+	k %= 5;
+
+	float binAngle = (float)(k*2*CV_PI/30);
+	float a = (float)cos(binAngle), b = (float)sin(binAngle);
+	float c = sqrt(3.0f);
+	float d = b*c/3;
+	b = a - d;
+	a = a + d;
+	c = 2 * d;
+
+	for (size_t i=0; i<tests.size(); i++)
+	{
+		Point p1 = rotatePoint(tests[i].p1, a, b, c, sextant);
+		Point p2 = rotatePoint(tests[i].p2, a, b, c, sextant);
+		if (center[p1.y*step + p1.x] < center[p2.y*step + p2.x])
+		{
+			tests[i].answers[feature/64] |= (uint64)1 << (feature%64);
+			tests[i].ones++;
+		}
+	}
+}
+
+// detect and orient the features of a panorama, and answer the tests on them
+static void samplePanorama(const SPHORB& sorb, const Mat& panorama, const Options& opt, vector<Test>& tests, int& features)
+{
+	for (int l=0; l<opt.levels && features<opt.features; l++)
+	{
+		vector<Mat> parts;
+		Mat mask;
+		sorb.storageGrid(panorama, l, parts, mask);
+
+		MaskSpans spans;
+		buildMaskSpans(mask, 0, spans);
+
+		for (size_t i=0; i<parts.size() && features<opt.features; i++)
+		{
+			KeyPointHeap heap;
+			heap.reset(opt.featuresPerPart);
+			sfastDetectNonmax(parts[i].data, (int)parts[i].step, spans, opt.barrier, heap, (int)i);
+
+			Mat smoothed;
+			sorb.smoothPart(parts[i], smoothed);
+
+			const vector<KeyPoint>& kps = heap.keypoints();
+			for (size_t k=0; k<kps.size() && features<opt.features; k++)
+			{
+				Point pt(cvRound(kps[k].pt.x), cvRound(kps[k].pt.y));
+				answerTests(smoothed, pt, orientation(parts[i], pt), features++, tests);
+			}
+		}
+	}
+}
+
+// the correlation of the answers of two tests on n features
+static double correlation(const Test& t1, const Test& t2, int n)
+{
+	int both = 0;
+	for (size_t w=0; w<t1.answers.size(); w++)
+		both += popcount(t1.answers[w] & t2.answers[w]);
+
+	double p1 = (double)t1.ones / n, p2 = (double)t2.ones / n;
+	double v = p1 * (1 - p1) * p2 * (1 - p2);
+	if (v <= 0)
+		return 1;
+	return ((double)both / n - p1 * p2) / sqrt(v);
+}
+
+struct MeanCloser
+{
+	int n;
+	bool operator()(const Test* t1, const Test* t2) const
+	{
+		return fabs((double)t1->ones / n - 0.5) < fabs((double)t2->ones / n - 0.5);
+	}
+};
+
+// the greedy selection, the maximal correlation of every selected test with the
+// tests before it goes to correlations
+static void selectTests(const vector<Test>& tests, int n, const Options& opt,
+						vector<const Test*>& selected, vector<double>& correlations)
+{
+	vector<const Test*> order;
+	for (size_t i=0; i<tests.size(); i++)
+		order.push_back(&tests[i]);
+	MeanCloser closer;
+	closer.n = n;
+	std::stable_sort(order.begin(), order.end(), closer);
+
+	// the threshold is raised by steps of 0.05 up to 1, counted so that no rounding
+	// error accumulates
+	int steps = opt.threshold <= 1.0 ? cvFloor((1.0 - opt.threshold) / 0.05 + 1e-9) : -1;
+	for (int k=0; k<=steps; k++)
+	{
+		double threshold = opt.threshold + k * 0.05;
+		selected.clear();
+		correlations.clear();
+		for (size_t i=0; i<order.size() && (int)selected.size()<opt.bits; i++)
+		{
+			double worst = 0;
+			for (size_t j=0; j<selected.size() && worst<threshold; j++)
+				worst = std::max(worst, fabs(correlation(*order[i], *selected[j], n)));
+
+			if (worst < threshold)
+			{
+				selected.push_back(order[i]);
+				correlations.push_back(worst);
+			}
+		}
+
+		fprintf(stderr, "threshold %.2f: %d tests\n", threshold, (int)selected.size());
+		if ((int)selected.size() == opt.bits)
+			return;
+	}
+}
+
+int main(int argc, char * argv[])
+{
+	Options opt;
+	opt.bits = 256;
+	opt.candidates = 20000;
+	opt.features = 20000;
+	opt.featuresPerPart = 100;
+	opt.levels = 3;
+	opt.barrier = 20;
+	opt.threshold = 0.2;
+
+	vector<const char*> files;
+	for (int i=1; i<argc; i++)
+	{
+		if (!strcmp(argv[i], "-n") && i+1 < argc)
+			opt.bits = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-c") && i+1 < argc)
+			opt.candidates = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-k") && i+1 < argc)
+			opt.features = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-f") && i+1 < argc)
+			opt.featuresPerPart = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-l") && i+1 < argc)
+			opt.levels = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-b") && i+1 < argc)
+			opt.barrier = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-t") && i+1 < argc)
+			opt.threshold = atof(argv[++i]);
+		else if (argv[i][0] == '-')
+		{
+			fprintf(stderr, "unknown option %s\n", argv[i]);
+			return 1;
+		}
+		else
+			files.push_back(argv[i]);
+	}
+
+	if (files.empty() || opt.bits < 1 || opt.candidates < opt.bits || opt.features < 1)
+	{
+		fprintf(stderr, "usage: pattern_train [options] panorama1 panorama2 ... > pattern.txt\n");
+		return 1;
+	}
+
+	vector<Test> tests;
+	if (!randomTests(opt, tests))
+		return 1;
+
+	// the answers of the candidate tests on the features of the panoramas
+	SPHORB sorb;
+	opt.levels = std::max(1, std::min(opt.levels, 7));
+	int features = 0;
+	for (size_t i=0; i<files.size() && features<opt.features; i++)
+	{
+		Mat panorama = imread(files[i], 0);
+		if (panorama.empty())
+		{
+			fprintf(stderr, "can not read %s\n", files[i]);
+			return 1;
+		}
+		samplePanorama(sorb, panorama, opt, tests, features);
+		fprintf(stderr, "%s: %d features\n", files[i], features);
+	}
+	if (features == 0)
+	{
+		fprintf(stderr, "no features\n");
+		return 1;
+	}
+
+	vector<const Test*> selected;
+	vector<double> correlations;
+	selectTests(tests, features, opt, selected, correlations);
+	if ((int)selected.size() < opt.bits)
+		fprintf(stderr, "only %d tests below the correlation 1\n", (int)selected.size());
+
+	fprintf(stderr, "increase PATTERN_REVISION in SPHORB.cpp along with bit_pattern\n");
+	printf("// the sampling pattern\n");
+	printf("static int bit_pattern[%d*4] =\n{\n", (int)selected.size());
+	for (size_t i=0; i<selected.size(); i++)
+	{
+		const Test* t = selected[i];
+		printf("\t%d, %d, %d, %d, /*mean (%g), correlation (%g)*/\n", t->p1.x, t->p1.y, t->p2.x, t->p2.y,
+			fabs((double)t->ones / features - 0.5), correlations[i]);
+	}
+	printf("};\n");
+
+	return 0;
+}
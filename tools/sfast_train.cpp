@@ -0,0 +1,993 @@
+/*
+	AUTHOR:
+	Qiang Zhao, email: qiangzhao@tju.edu.cn
+	Copyright (C) 2015 Tianjin University
+	School of Computer Software
+	School of Computer Science and Technology
+
+	LICENSE:
+	SPHORB is distributed under the GNU General Public License.  For information on
+	commercial licensing, please contact the authors at the contact address below.
+
+	REFERENCE:
+	@article{zhao-SPHORB,
+	author   = {Qiang Zhao and Wei Feng and Liang Wan and Jiawan Zhang},
+	title    = {SPHORB: A Fast and Robust Binary Feature on the Sphere},
+	journal  = {International Journal of Computer Vision},
+	year     = {2015},
+	volume   = {113},
+	number   = {2},
+	pages    = {143-159},
+	}
+
+
+	Training and code generation of the spherical FAST detector (detector.cpp).
+
+	The detector compares the 18 pixels of the hexagonal ring of radius 3 with the
+	centre pixel. A pixel is a corner when corner_type contiguous ring pixels are all
+	brighter than the centre plus the barrier, or all darker than the centre minus it.
+	Following Rosten and Drummond, the order of the questions is learned with ID3 from
+	the ring configurations of the storage grids of training panoramas. A branch of
+	the tree only ends when the answers decide the segment test, so the generated
+	detector is exact, also for the configurations missing from the training data.
+	Without panoramas the tree is learned from random configurations.
+
+	Usage:
+	sfast_train [options] panorama1 panorama2 ... > detector.cpp
+
+	Options:
+	-b barrier		threshold used to label the training pixels (25)
+	-n corner_type	number of contiguous ring pixels of a corner (10)
+	-l levels		number of pyramid levels sampled from every panorama (1)
+	-p pointers		number of ring pixels read through running pointers (2)
+	-f question		ring pixel asked first, -1 to learn it (-1)
+	-s similar		probability of a similar ring pixel in random configurations (0.3)
+	-r samples		number of random configurations used without panoramas (2000000)
+	-labels			emit the tree as labelled nodes sharing identical subtrees,
+					instead of nested branches
+	-profile		test the answers of every question in the order of their
+					frequency in the training data
+	-agast			emit the adaptive detector agast_corner_detect_span instead, which
+					switches between a tree for homogeneous and a tree for structured
+					configurations, depending on the answers for the pixel before
+	-hs similar		probability of a similar ring pixel in random homogeneous configurations (0.7)
+	-ss similar		probability of a similar ring pixel in random structured configurations (0.1)
+	-check file		compare the generated code with file instead of printing it, and fail
+					when they differ
+
+	With panoramas, the adaptive detector splits their configurations by the number
+	of similar ring pixels. Run it from the root directory, it needs the Data folder.
+
+	The random configurations are drawn as integers of RNG with the fixed seed
+	0x12345678, so that agast.cpp is reproduced exactly by "sfast_train -agast" with
+	the default options, whatever the version of OpenCV.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include "SPHORB.h"
+
+using namespace std;
+using namespace cv;
+
+enum { RING = 18 };
+
+// the hexagonal ring, in the order of makeOffsets
+static const int ringX[RING] = {0, 1, 2, 3, 3, 3, 3, 2, 1, 0, -1, -2, -3, -3, -3, -3, -2, -1};
+static const int ringY[RING] = {3, 2, 1, 0, -1, -2, -3, -3, -3, -3, -2, -1, 0, 1, 2, 3, 3, 3};
+
+// the answers to a question on a ring pixel
+enum { BRIGHTER = 0, DARKER = 1, SIMILAR = 2 };
+
+struct Options
+{
+	int barrier;
+	int cornerType;
+	int levels;
+	int pointers;
+	int firstQuestion;
+	double similarRatio;
+	int randomSamples;
+	bool labels;
+	bool profile;
+	bool agast;
+	double homogeneousRatio;
+	double structuredRatio;
+	const char* check;
+};
+
+// a ring configuration, with two bits for the answer of every ring pixel
+struct Sample
+{
+	uint64 key;
+	double weight;
+	bool corner;
+};
+
+// the decisions of a leaf, the adaptive detector continues a non-corner
+// with the tree of the homogeneous or of the structured configurations
+enum { NOT_CORNER = 0, CORNER = 1, NOT_CORNER_HOMOGENEOUS = 2, DECISIONS = 3 };
+
+struct Node
+{
+	int question;		// the ring pixel asked, -1 for a leaf
+	int decision;		// the decision of a leaf
+	int child[3];		// the nodes following the brighter, darker and similar answers
+	double weight[3];	// the training weight of every answer
+	int id;				// nodes with the same id have identical subtrees
+};
+
+static vector<int> arcs;
+static vector<Node> tree;
+static double questions = 0;
+
+static int popcount(int bits)
+{
+	int n = 0;
+	for (; bits; bits &= bits - 1)
+		n++;
+	return n;
+}
+
+static inline int answerOf(uint64 key, int q)
+{
+	return (int)((key >> (2*q)) & 3);
+}
+
+// the bit masks of the arcs of n contiguous ring pixels
+static void makeArcs(int n)
+{
+	arcs.clear();
+	for (int s=0; s<RING; s++)
+	{
+		int arc = 0;
+		for (int k=0; k<n; k++)
+			arc |= 1 << ((s+k)%RING);
+		arcs.push_back(arc);
+	}
+}
+
+static bool isCorner(uint64 key)
+{
+	int bright = 0, dark = 0;
+	for (int q=0; q<RING; q++)
+	{
+		if (answerOf(key, q) == BRIGHTER)
+			bright |= 1 << q;
+		else if (answerOf(key, q) == DARKER)
+			dark |= 1 << q;
+	}
+	for (size_t i=0; i<arcs.size(); i++)
+		if ((arcs[i] & bright) == arcs[i] || (arcs[i] & dark) == arcs[i])
+			return true;
+	return false;
+}
+
+struct KeyLess
+{
+	bool operator()(const Sample& a, const Sample& b) const { return a.key < b.key; }
+};
+
+// sort the configurations and merge the equal ones
+static void mergeSamples(vector<Sample>& samples)
+{
+	if (samples.empty())
+		return;
+
+	std::sort(samples.begin(), samples.end(), KeyLess());
+
+	size_t n = 0;
+	for (size_t i=1; i<samples.size(); i++)
+	{
+		if (samples[i].key == samples[n].key)
+			samples[n].weight += samples[i].weight;
+		else
+			samples[++n] = samples[i];
+	}
+	samples.resize(n+1);
+}
+
+// the ring configurations of the valid pixels of the storage grids of a panorama
+static void samplePanorama(const SPHORB& sorb, const Mat& panorama, const Options& opt, vector<Sample>& samples)
+{
+	for (int l=0; l<opt.levels; l++)
+	{
+		vector<Mat> parts;
+		Mat mask;
+		sorb.storageGrid(panorama, l, parts, mask);
+
+		for (size_t i=0; i<parts.size(); i++)
+		{
+			int step = (int)parts[i].step;
+			for (int y=0; y<mask.rows; y++)
+			{
+				for (int x=0; x<mask.cols; x++)
+				{
+					if (mask.at<uchar>(y, x) == 0)
+						continue;
+
+					const uchar* p = &parts[i].at<uchar>(y, x);
+					int cb = *p + opt.barrier;
+					int c_b = *p - opt.barrier;
+
+					Sample s;
+					s.key = 0;
+					s.weight = 1;
+					for (int q=0; q<RING; q++)
+					{
+						int v = p[ringX[q] + ringY[q]*step];
+						uint64 a = v > cb ? BRIGHTER : (v < c_b ? DARKER : SIMILAR);
+						s.key |= a << (2*q);
+					}
+					samples.push_back(s);
+				}
+			}
+		}
+	}
+}
+
+// random configurations, whose ring pixels are independent; the draws are the integers
+// of RNG::next, split by the ratios, so that the configurations only depend on the
+// sequence of the generator and not on how a version of OpenCV converts it to doubles
+static void sampleRandom(const Options& opt, double similarRatio, vector<Sample>& samples)
+{
+	const double range = 4294967296.0;
+	uint64 similar = (uint64)(similarRatio * range);
+	uint64 brighter = (uint64)((1 + similarRatio) / 2 * range);
+
+	RNG rng(0x12345678);
+	for (int i=0; i<opt.randomSamples; i++)
+	{
+		Sample s;
+		s.key = 0;
+		s.weight = 1;
+		for (int q=0; q<RING; q++)
+		{
+			uint64 r = rng.next();
+			uint64 a = r < similar ? SIMILAR : (r < brighter ? BRIGHTER : DARKER);
+			s.key |= a << (2*q);
+		}
+		samples.push_back(s);
+	}
+}
+
+static double entropy(double w, double c)
+{
+	if (c <= 0 || c >= w)
+		return 0;
+	double p = c / w;
+	return -w * (p*log(p) + (1-p)*log(1-p));
+}
+
+// Choose the question on the unknown ring pixels which leaves the least entropy of
+// the training samples. Ties, including the nodes without samples, go to the pixel
+// lying on the most arcs which may still form a corner.
+static int chooseQuestion(const vector<Sample>& samples, int begin, int end, int bright, int dark, int similar)
+{
+	int known = bright | dark | similar;
+	double w[RING][3], c[RING][3];
+	memset(w, 0, sizeof(w));
+	memset(c, 0, sizeof(c));
+
+	double total = 0;
+	for (int i=begin; i<end; i++)
+	{
+		total += samples[i].weight;
+		for (int q=0; q<RING; q++)
+		{
+			if (known & (1 << q))
+				continue;
+			int a = answerOf(samples[i].key, q);
+			w[q][a] += samples[i].weight;
+			if (samples[i].corner)
+				c[q][a] += samples[i].weight;
+		}
+	}
+
+	int best = -1;
+	double bestEntropy = 0;
+	int bestArcs = 0;
+	for (int q=0; q<RING; q++)
+	{
+		if (known & (1 << q))
+			continue;
+
+		double h = entropy(w[q][0], c[q][0]) + entropy(w[q][1], c[q][1]) + entropy(w[q][2], c[q][2]);
+		int n = 0;
+		for (size_t i=0; i<arcs.size(); i++)
+		{
+			if (!(arcs[i] & (1 << q)))
+				continue;
+			n += (arcs[i] & (dark | similar)) == 0;
+			n += (arcs[i] & (bright | similar)) == 0;
+		}
+
+		double eps = 1e-9 * (total + 1);
+		if (best < 0 || h < bestEntropy - eps || (h < bestEntropy + eps && n > bestArcs))
+		{
+			best = q;
+			bestEntropy = h;
+			bestArcs = n;
+		}
+	}
+	return best;
+}
+
+// build the subtree of the samples [begin, end), given the ring pixels already known
+static int build(vector<Sample>& samples, int begin, int end, int bright, int dark, int similar, int depth, const Options& opt)
+{
+	int index = (int)tree.size();
+	Node node;
+	node.question = -1;
+	node.decision = NOT_CORNER;
+	node.child[0] = node.child[1] = node.child[2] = -1;
+	node.weight[0] = node.weight[1] = node.weight[2] = 0;
+	node.id = -1;
+	tree.push_back(node);
+
+	// a leaf when the answers decide the segment test
+	bool certain = false, possible = false;
+	for (size_t i=0; i<arcs.size(); i++)
+	{
+		if ((arcs[i] & bright) == arcs[i] || (arcs[i] & dark) == arcs[i])
+			certain = true;
+		if ((arcs[i] & (dark | similar)) == 0 || (arcs[i] & (bright | similar)) == 0)
+			possible = true;
+	}
+	if (certain || !possible)
+	{
+		// the next pixel is likely homogeneous when most answers were similar
+		if (certain)
+			tree[index].decision = CORNER;
+		else if (opt.agast && popcount(similar) >= popcount(bright | dark))
+			tree[index].decision = NOT_CORNER_HOMOGENEOUS;
+		return index;
+	}
+
+	int q;
+	if (depth == 0 && opt.firstQuestion >= 0)
+		q = opt.firstQuestion;
+	else
+		q = chooseQuestion(samples, begin, end, bright, dark, similar);
+
+	// split the samples by their answer
+	int bounds[4];
+	bounds[0] = begin;
+	for (int a=0; a<3; a++)
+	{
+		int i = bounds[a];
+		for (int j=bounds[a]; j<end; j++)
+		{
+			if (answerOf(samples[j].key, q) == a)
+				std::swap(samples[i++], samples[j]);
+		}
+		bounds[a+1] = i;
+
+		for (int j=bounds[a]; j<bounds[a+1]; j++)
+			tree[index].weight[a] += samples[j].weight;
+	}
+	questions += tree[index].weight[0] + tree[index].weight[1] + tree[index].weight[2];
+
+	tree[index].question = q;
+	int child[3];
+	child[BRIGHTER] = build(samples, bounds[0], bounds[1], bright | (1 << q), dark, similar, depth+1, opt);
+	child[DARKER] = build(samples, bounds[1], bounds[2], bright, dark | (1 << q), similar, depth+1, opt);
+	child[SIMILAR] = build(samples, bounds[2], bounds[3], bright, dark, similar | (1 << q), depth+1, opt);
+	for (int a=0; a<3; a++)
+		tree[index].child[a] = child[a];
+
+	return index;
+}
+
+// give identical subtrees the same id, and bypass the questions whose answer does not matter
+static int identify(int n, map<vector<int>, int>& ids)
+{
+	Node& node = tree[n];
+	if (node.question < 0)
+		return node.id = node.decision;
+
+	int a = identify(node.child[0], ids);
+	int b = identify(node.child[1], ids);
+	int c = identify(node.child[2], ids);
+	if (a == b && b == c)
+		return node.id = a;
+
+	vector<int> key(4);
+	key[0] = node.question;
+	key[1] = a;
+	key[2] = b;
+	key[3] = c;
+	map<vector<int>, int>::iterator it = ids.find(key);
+	if (it == ids.end())
+		it = ids.insert(make_pair(key, (int)ids.size() + DECISIONS)).first;
+	return node.id = it->second;
+}
+
+// the node standing for a subtree, skipping the questions whose answer does not matter
+static int resolve(int n)
+{
+	while (tree[n].question >= 0 && tree[tree[n].child[0]].id == tree[n].id)
+		n = tree[n].child[0];
+	return n;
+}
+
+// the ring pixels read through running pointers, the most asked ones off the centre row
+static vector<int> choosePointers(int count)
+{
+	vector<double> asked(RING, 0);
+	for (size_t n=0; n<tree.size(); n++)
+		if (tree[n].question >= 0)
+			asked[tree[n].question] += 1 + tree[n].weight[0] + tree[n].weight[1] + tree[n].weight[2];
+
+	vector<int> pointers;
+	for (int k=0; k<count; k++)
+	{
+		int best = -1;
+		for (int q=0; q<RING; q++)
+		{
+			if (ringY[q] == 0 || std::find(pointers.begin(), pointers.end(), q) != pointers.end())
+				continue;
+			bool sameRow = false;
+			for (size_t j=0; j<pointers.size(); j++)
+				sameRow |= ringY[pointers[j]] == ringY[q];
+			if (sameRow)
+				continue;
+			if (best < 0 || asked[q] > asked[best])
+				best = q;
+		}
+		if (best < 0)
+			break;
+		pointers.push_back(best);
+	}
+	return pointers;
+}
+
+struct Emitter
+{
+	FILE* f;
+	vector<int> pointers;
+	const char* leaf[DECISIONS];	// the statements for every decision of a leaf
+	bool profile;
+
+	string pixel(int q) const
+	{
+		char buf[64];
+		if (ringY[q] == 0)
+		{
+			sprintf(buf, "*(cache_0+%d)", ringX[q]);
+			return buf;
+		}
+		for (size_t j=0; j<pointers.size(); j++)
+		{
+			if (pointers[j] == q)
+			{
+				sprintf(buf, "*cache_%d", (int)j+1);
+				return buf;
+			}
+		}
+		for (size_t j=0; j<pointers.size(); j++)
+		{
+			if (ringY[pointers[j]] == ringY[q])
+			{
+				sprintf(buf, "*(cache_%d+%d)", (int)j+1, ringX[q] - ringX[pointers[j]]);
+				return buf;
+			}
+		}
+		sprintf(buf, "*(cache_0 + pixel[%d])", q);
+		return buf;
+	}
+
+	// the condition for a set of answers, one bit per answer
+	string condition(int q, int answers) const
+	{
+		string p = pixel(q);
+		switch (answers)
+		{
+		case 1 << BRIGHTER:					return p + " > cb";
+		case 1 << DARKER:					return p + " < c_b";
+		case 1 << SIMILAR:					return p + " >= c_b && " + p + " <= cb";
+		case (1 << BRIGHTER) | (1 << DARKER):	return p + " > cb||" + p + " < c_b";
+		case (1 << BRIGHTER) | (1 << SIMILAR):	return p + " >= c_b";
+		default:							return p + " <= cb";
+		}
+	}
+
+	// the answers of a node grouped by the subtree they lead to, the last group is the else branch
+	void groups(const Node& node, vector<int>& answers, vector<int>& children) const
+	{
+		answers.clear();
+		children.clear();
+		vector<double> weights;
+		for (int a=0; a<3; a++)
+		{
+			int child = resolve(node.child[a]);
+			size_t g = 0;
+			for (; g<children.size(); g++)
+				if (tree[children[g]].id == tree[child].id)
+					break;
+			if (g == children.size())
+			{
+				answers.push_back(0);
+				children.push_back(child);
+				weights.push_back(0);
+			}
+			answers[g] |= 1 << a;
+			weights[g] += node.weight[a];
+		}
+
+		// the most frequent answers are tested first
+		if (profile)
+		{
+			for (size_t i=1; i<weights.size(); i++)
+			{
+				for (size_t j=i; j>0 && weights[j] > weights[j-1]; j--)
+				{
+					std::swap(weights[j], weights[j-1]);
+					std::swap(answers[j], answers[j-1]);
+					std::swap(children[j], children[j-1]);
+				}
+			}
+		}
+	}
+
+	void nested(int n, const string& indent) const
+	{
+		n = resolve(n);
+		const Node& node = tree[n];
+		if (node.question < 0)
+		{
+			fprintf(f, "%s%s\n", indent.c_str(), leaf[node.decision]);
+			return;
+		}
+
+		vector<int> answers, children;
+		groups(node, answers, children);
+		for (size_t g=0; g<children.size(); g++)
+		{
+			if (g == 0)
+				fprintf(f, "%sif(%s)\n", indent.c_str(), condition(node.question, answers[g]).c_str());
+			else if (g+1 < children.size())
+				fprintf(f, "%selse if(%s)\n", indent.c_str(), condition(node.question, answers[g]).c_str());
+			else
+				fprintf(f, "%selse\n", indent.c_str());
+			nested(children[g], indent + "    ");
+		}
+	}
+
+	// the unique nodes in emission order, every node followed by its else subtree if possible
+	void order(int n, vector<int>& nodes, vector<bool>& emitted) const
+	{
+		n = resolve(n);
+		if (tree[n].question < 0 || emitted[tree[n].id])
+			return;
+		emitted[tree[n].id] = true;
+		nodes.push_back(n);
+
+		vector<int> answers, children;
+		groups(tree[n], answers, children);
+		order(children.back(), nodes, emitted);
+		for (size_t g=0; g+1<children.size(); g++)
+			order(children[g], nodes, emitted);
+	}
+
+	// the label of the first node of a tree
+	int label(int root) const
+	{
+		return tree[resolve(root)].id;
+	}
+
+	// Emit the trees as labelled nodes, sharing the identical subtrees. The code
+	// before falls through into the first tree when enter is set, the other trees
+	// are entered with a goto.
+	void labels(const vector<int>& roots, const string& indent, int ids, bool enter) const
+	{
+		vector<int> nodes;
+		vector<bool> emitted(ids, false);
+		for (size_t r=0; r<roots.size(); r++)
+			order(roots[r], nodes, emitted);
+
+		// the nodes reached by a goto
+		vector<bool> referenced(ids, false);
+		for (size_t r=enter ? 1 : 0; r<roots.size(); r++)
+			referenced[label(roots[r])] = true;
+		for (size_t i=0; i<nodes.size(); i++)
+		{
+			vector<int> answers, children;
+			groups(tree[nodes[i]], answers, children);
+			for (size_t g=0; g<children.size(); g++)
+			{
+				const Node& child = tree[children[g]];
+				bool fallthrough = g+1 == children.size() && i+1 < nodes.size() && tree[nodes[i+1]].id == child.id;
+				if (child.question >= 0 && !fallthrough)
+					referenced[child.id] = true;
+			}
+		}
+
+		for (size_t i=0; i<nodes.size(); i++)
+		{
+			const Node& node = tree[nodes[i]];
+			if (referenced[node.id])
+				fprintf(f, "%snode_%d:\n", indent.c_str(), node.id);
+
+			vector<int> answers, children;
+			groups(node, answers, children);
+			for (size_t g=0; g<children.size(); g++)
+			{
+				const Node& child = tree[children[g]];
+				string target;
+				if (child.question < 0)
+					target = leaf[child.decision];
+				else
+				{
+					char buf[32];
+					sprintf(buf, "goto node_%d;", child.id);
+					target = buf;
+				}
+
+				if (g+1 < children.size())
+					fprintf(f, "%s\tif(%s)\n%s\t\t%s\n", indent.c_str(), condition(node.question, answers[g]).c_str(),
+						indent.c_str(), target.c_str());
+				else if (child.question < 0 || i+1 == nodes.size() || tree[nodes[i+1]].id != child.id)
+					fprintf(f, "%s\t%s\n", indent.c_str(), target.c_str());
+			}
+		}
+	}
+};
+
+static const char* license =
+"/*\n"
+"\tAUTHOR:\n"
+"\tQiang Zhao, email: qiangzhao@tju.edu.cn\n"
+"\tCopyright (C) 2015 Tianjin University\n"
+"\tSchool of Computer Software\n"
+"\tSchool of Computer Science and Technology\n"
+"\n"
+"\tLICENSE:\n"
+"\tSPHORB is distributed under the GNU General Public License.  For information on \n"
+"\tcommercial licensing, please contact the authors at the contact address below.\n"
+"\n"
+"\tREFERENCE:\n"
+"\t@article{zhao-SPHORB,\n"
+"\tauthor   = {Qiang Zhao and Wei Feng and Liang Wan and Jiawan Zhang},\n"
+"\ttitle    = {SPHORB: A Fast and Robust Binary Feature on the Sphere},\n"
+"\tjournal  = {International Journal of Computer Vision},\n"
+"\tyear     = {2015},\n"
+"\tvolume   = {113},\n"
+"\tnumber   = {2},\n"
+"\tpages    = {143-159},\n"
+"\t}\n"
+"\n"
+"\t\n"
+"\tAutomatically generated code using the scheme of Rosten and Drummond\n"
+"\tE. Rosten and T. Drummond. Machine learning for highspeed corner detection. \n"
+"\tIn Proceedings of the European Conference on Computer Vision (ECCV), 2006.\n"
+"\n";
+
+static void emitHeader(FILE* f, const Emitter& e, const Options& opt, int frames, double potential, double real)
+{
+	fprintf(f, "%s", license);
+	fprintf(f, "\n\tParameters:\n");
+	fprintf(f, "\tbranch_layout = %s\n", opt.labels ? "labels" : "nested");
+	fprintf(f, "\tprofile_order = %d\n", opt.profile ? 1 : 0);
+	fprintf(f, "\tadaptive_trees = %d\n", opt.agast ? 2 : 1);
+	fprintf(f, "\tcorner_pointers = %d\n", (int)e.pointers.size());
+	fprintf(f, "\tforce_first_question = %d\n", opt.firstQuestion);
+	fprintf(f, "\tcorner_type = %d\n", opt.cornerType);
+	fprintf(f, "\tbarrier = %d\n", opt.barrier);
+	fprintf(f, "\n\tData:\n");
+	fprintf(f, "\tNumber of frames:    %d\n", frames);
+	if (frames == 0 && opt.agast)
+		fprintf(f, "\tSimilar ratio:       %g %g\n", opt.homogeneousRatio, opt.structuredRatio);
+	else if (frames == 0)
+		fprintf(f, "\tSimilar ratio:       %g\n", opt.similarRatio);
+	fprintf(f, "\tPotential features:  %.0f\n", potential);
+	fprintf(f, "\tReal features:       %.0f\n", real);
+	fprintf(f, "\tQuestions per pixel: %g\n", potential > 0 ? questions / potential : 0.0);
+	fprintf(f, "*/\n\n");
+
+	fprintf(f, "#include \"detector.h\"\n\n");
+}
+
+// the declarations of a detector of a run of pixels, with cache_0 at the pixel first
+static void emitDetectPrologue(FILE* f, const Emitter& e, const char* name, int first)
+{
+	fprintf(f, "// detect the corners on the run [xbegin, xend) of row y, writing their x coordinates to xs\n");
+	fprintf(f, "int %s(const byte* im, int xstride, int y, int xbegin, int xend, int barrier, int* xs)\n{\n", name);
+	fprintf(f, "\tint cb, c_b;\n");
+	fprintf(f, "\tconst byte  *line_max, *line_min;\n");
+	fprintf(f, "\tint\t\t\ttotal=0;\n");
+	fprintf(f, "\tconst byte* cache_0;\n");
+	for (size_t j=0; j<e.pointers.size(); j++)
+		fprintf(f, "\tconst byte* cache_%d;\n", (int)j+1);
+	fprintf(f, "\tint\tpixel[18];\n\n");
+	for (int q=0; q<RING; q++)
+		fprintf(f, "\tpixel[%d] = %d + %d * xstride;\n", q, ringX[q], ringY[q]);
+	fprintf(f, "\tline_min = im + y*xstride;\n");
+	fprintf(f, "\tline_max = line_min + xend;\n");
+	if (first == 0)
+		fprintf(f, "\tcache_0 = line_min + xbegin;\n\n");
+	else
+		fprintf(f, "\tcache_0 = line_min + xbegin %c %d;\n\n", first < 0 ? '-' : '+', abs(first));
+	for (size_t j=0; j<e.pointers.size(); j++)
+		fprintf(f, "\tcache_%d = cache_0 + pixel[%d];\n", (int)j+1, e.pointers[j]);
+}
+
+static void emitDetect(FILE* f, Emitter& e, int root, int ids, const Options& opt)
+{
+	emitDetectPrologue(f, e, "sfast_corner_detect_span", 0);
+	fprintf(f, "\n\tfor(; cache_0 < line_max; cache_0++");
+	for (size_t j=0; j<e.pointers.size(); j++)
+		fprintf(f, ", cache_%d++", (int)j+1);
+	fprintf(f, ")\n\t{\n");
+	fprintf(f, "\t\tcb = *cache_0 + barrier;\n");
+	fprintf(f, "\t\tc_b = *cache_0 - barrier;\n");
+	e.leaf[NOT_CORNER] = e.leaf[NOT_CORNER_HOMOGENEOUS] = "continue;";
+	e.leaf[CORNER] = "goto success;";
+	// the label is at the indentation of the tree, after it rather than under its last else,
+	// and its statement one level deeper, with the tabs or spaces of the tree
+	const char* indent = opt.labels ? "\t" : "            ";
+	const char* inner = opt.labels ? "\t" : "    ";
+	if (opt.labels)
+		e.labels(vector<int>(1, root), indent, ids, true);
+	else
+		e.nested(root, indent);
+	fprintf(f, "%ssuccess:\n", indent);
+	fprintf(f, "%s%sxs[total++] = (int)(cache_0-line_min);\n", indent, inner);
+	fprintf(f, "\t}\n\treturn total;\n}\n\n");
+}
+
+// the step to the next pixel, which is examined with the tree of the label
+static void emitAgastStep(FILE* f, const Emitter& e, const char* label)
+{
+	fprintf(f, "\t%s:\n", label);
+	fprintf(f, "\tcache_0++;\n");
+	for (size_t j=0; j<e.pointers.size(); j++)
+		fprintf(f, "\tcache_%d++;\n", (int)j+1);
+	fprintf(f, "\tif(cache_0 >= line_max)\n");
+	fprintf(f, "\t\treturn total;\n");
+	fprintf(f, "\tcb = *cache_0 + barrier;\n");
+	fprintf(f, "\tc_b = *cache_0 - barrier;\n");
+}
+
+// AGAST: the tree of a pixel depends on the configuration of the pixel before
+static void emitAgastDetect(FILE* f, Emitter& e, int homogeneous, int structured, int ids)
+{
+	emitDetectPrologue(f, e, "agast_corner_detect_span", -1);
+	fprintf(f, "\n");
+	emitAgastStep(f, e, "homogeneous");
+	fprintf(f, "\tgoto node_%d;\n\n", e.label(homogeneous));
+	fprintf(f, "\tsuccess:\n");
+	fprintf(f, "\txs[total++] = (int)(cache_0-line_min);\n");
+	emitAgastStep(f, e, "structured");
+
+	e.leaf[NOT_CORNER] = "goto structured;";
+	e.leaf[NOT_CORNER_HOMOGENEOUS] = "goto homogeneous;";
+	e.leaf[CORNER] = "goto success;";
+	vector<int> roots;
+	roots.push_back(structured);
+	roots.push_back(homogeneous);
+	e.labels(roots, "\t", ids, true);
+	fprintf(f, "}\n\n");
+}
+
+static void emitScore(FILE* f, Emitter& e, int root, int ids, const Options& opt)
+{
+	// the score, the highest threshold the pixel is a corner for
+	fprintf(f, "int sfast_corner_score(const byte* im, const int pixel[], int bstart)\n{\n");
+	fprintf(f, "\tint bmin = bstart;\n");
+	fprintf(f, "\tint bmax = 255;\n");
+	fprintf(f, "\tint b = (bmax + bmin)/2;\n");
+	fprintf(f, "\tconst byte* cache_0 = im;\n");
+	for (size_t j=0; j<e.pointers.size(); j++)
+		fprintf(f, "\tconst byte* cache_%d = cache_0 + pixel[%d];\n", (int)j+1, e.pointers[j]);
+	fprintf(f, "\tfor(;;)\n\t{\n");
+	fprintf(f, "\t\tint cb = *cache_0 + b;\n");
+	fprintf(f, "\t\tint c_b = *cache_0 - b;\n");
+	e.leaf[NOT_CORNER] = e.leaf[NOT_CORNER_HOMOGENEOUS] = "goto is_not_a_corner;";
+	e.leaf[CORNER] = "goto is_a_corner;";
+	if (opt.labels)
+		e.labels(vector<int>(1, root), "\t", ids, true);
+	else
+		e.nested(root, "\t    ");
+	fprintf(f, "\t\tis_a_corner:\n");
+	fprintf(f, "\t\t\tbmin = b;\n");
+	fprintf(f, "\t\t\tgoto end_if;\n\n");
+	fprintf(f, "\t\tis_not_a_corner:\n");
+	fprintf(f, "\t\t\tbmax = b;\n");
+	fprintf(f, "\t\t\tgoto end_if;\n\n");
+	fprintf(f, "\t\tend_if:\n");
+	fprintf(f, "\t\tif(bmin == bmax - 1 || bmin == bmax)\n");
+	fprintf(f, "\t\t\treturn bmin;\n");
+	fprintf(f, "\t\tb = (bmin + bmax) / 2;\n");
+	fprintf(f, "\t}\n}\n");
+}
+
+// compare the generated code with a file, returns 0 when they are the same
+static int checkCode(FILE* code, const char* fileName)
+{
+	FILE* f = fopen(fileName, "rb");
+	if (f == NULL)
+	{
+		fprintf(stderr, "can not read %s\n", fileName);
+		return 1;
+	}
+
+	rewind(code);
+	int line = 1, a, b;
+	do
+	{
+		a = fgetc(code);
+		b = fgetc(f);
+		if (a == b && a == '\n')
+			line++;
+	} while (a == b && a != EOF);
+	fclose(f);
+
+	if (a != b)
+	{
+		fprintf(stderr, "%s differs from the generated code at line %d\n", fileName, line);
+		return 1;
+	}
+	fprintf(stderr, "%s is the generated code\n", fileName);
+	return 0;
+}
+
+int main(int argc, char * argv[])
+{
+	Options opt;
+	opt.barrier = 25;
+	opt.cornerType = 10;
+	opt.levels = 1;
+	opt.pointers = 2;
+	opt.firstQuestion = -1;
+	opt.similarRatio = 0.3;
+	opt.randomSamples = 2000000;
+	opt.labels = false;
+	opt.profile = false;
+	opt.agast = false;
+	opt.homogeneousRatio = 0.7;
+	opt.structuredRatio = 0.1;
+	opt.check = NULL;
+
+	vector<const char*> files;
+	for (int i=1; i<argc; i++)
+	{
+		if (!strcmp(argv[i], "-b") && i+1 < argc)
+			opt.barrier = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-n") && i+1 < argc)
+			opt.cornerType = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-l") && i+1 < argc)
+			opt.levels = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-p") && i+1 < argc)
+			opt.pointers = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-f") && i+1 < argc)
+			opt.firstQuestion = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-s") && i+1 < argc)
+			opt.similarRatio = atof(argv[++i]);
+		else if (!strcmp(argv[i], "-r") && i+1 < argc)
+			opt.randomSamples = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-labels"))
+			opt.labels = true;
+		else if (!strcmp(argv[i], "-profile"))
+			opt.profile = true;
+		else if (!strcmp(argv[i], "-agast"))
+			opt.agast = true;
+		else if (!strcmp(argv[i], "-hs") && i+1 < argc)
+			opt.homogeneousRatio = atof(argv[++i]);
+		else if (!strcmp(argv[i], "-ss") && i+1 < argc)
+			opt.structuredRatio = atof(argv[++i]);
+		else if (!strcmp(argv[i], "-check") && i+1 < argc)
+			opt.check = argv[++i];
+		else if (argv[i][0] == '-')
+		{
+			fprintf(stderr, "unknown option %s\n", argv[i]);
+			return 1;
+		}
+		else
+			files.push_back(argv[i]);
+	}
+
+	if (opt.cornerType < 1 || opt.cornerType > RING || opt.firstQuestion >= RING || opt.pointers < 0)
+	{
+		fprintf(stderr, "invalid parameters\n");
+		return 1;
+	}
+	makeArcs(opt.cornerType);
+
+	// the ring configurations of the training data
+	vector<Sample> samples;
+	if (!files.empty())
+	{
+		SPHORB sorb;
+		opt.levels = std::max(1, std::min(opt.levels, 7));
+		for (size_t i=0; i<files.size(); i++)
+		{
+			Mat panorama = imread(files[i], 0);
+			if (panorama.empty())
+			{
+				fprintf(stderr, "can not read %s\n", files[i]);
+				return 1;
+			}
+			samplePanorama(sorb, panorama, opt, samples);
+			mergeSamples(samples);
+			fprintf(stderr, "%s: %d configurations\n", files[i], (int)samples.size());
+		}
+	}
+	else if (opt.agast)
+	{
+		sampleRandom(opt, opt.homogeneousRatio, samples);
+		sampleRandom(opt, opt.structuredRatio, samples);
+		mergeSamples(samples);
+	}
+	else
+	{
+		sampleRandom(opt, opt.similarRatio, samples);
+		mergeSamples(samples);
+	}
+
+	double potential = 0, real = 0;
+	for (size_t i=0; i<samples.size(); i++)
+	{
+		samples[i].corner = isCorner(samples[i].key);
+		potential += samples[i].weight;
+		if (samples[i].corner)
+			real += samples[i].weight;
+	}
+
+	Emitter e;
+	// the code goes to a temporary file when it is checked
+	FILE* out = opt.check ? tmpfile() : stdout;
+	if (out == NULL)
+	{
+		fprintf(stderr, "can not create a temporary file\n");
+		return 1;
+	}
+	e.f = out;
+	e.profile = opt.profile;
+	map<vector<int>, int> ids;
+	if (opt.agast)
+	{
+		// the homogeneous configurations come first
+		int homogeneous = 0;
+		for (size_t i=0; i<samples.size(); i++)
+		{
+			int similar = 0;
+			for (int q=0; q<RING; q++)
+				similar += answerOf(samples[i].key, q) == SIMILAR;
+			if (similar >= RING/2)
+				std::swap(samples[homogeneous++], samples[i]);
+		}
+
+		int homogeneousRoot = build(samples, 0, homogeneous, 0, 0, 0, 0, opt);
+		int structuredRoot = build(samples, homogeneous, (int)samples.size(), 0, 0, 0, 0, opt);
+		identify(homogeneousRoot, ids);
+		identify(structuredRoot, ids);
+		fprintf(stderr, "%d nodes, %d distinct subtrees\n", (int)tree.size(), (int)ids.size());
+
+		e.pointers = choosePointers(opt.pointers);
+		opt.labels = true;
+		emitHeader(out, e, opt, (int)files.size(), potential, real);
+		emitAgastDetect(out, e, homogeneousRoot, structuredRoot, (int)ids.size() + DECISIONS);
+	}
+	else
+	{
+		int root = build(samples, 0, (int)samples.size(), 0, 0, 0, 0, opt);
+		identify(root, ids);
+		fprintf(stderr, "%d nodes, %d distinct subtrees\n", (int)tree.size(), (int)ids.size());
+
+		e.pointers = choosePointers(opt.pointers);
+		emitHeader(out, e, opt, (int)files.size(), potential, real);
+		emitDetect(out, e, root, (int)ids.size() + DECISIONS, opt);
+		emitScore(out, e, root, (int)ids.size() + DECISIONS, opt);
+	}
+
+	if (opt.check)
+		return checkCode(out, opt.check);
+	return 0;
+}